@@ -23,7 +23,19 @@ rm -rf "$CPP_DIR/CMakeFiles" \
        "$CPP_DIR/CMakeCache.txt" \
        "$CPP_DIR/Makefile" \
        "$CPP_DIR/signal_processor.js" \
-       "$CPP_DIR/signal_processor.wasm"
+       "$CPP_DIR/signal_processor.wasm" \
+       "$CPP_DIR/signal_processor_simd.js" \
+       "$CPP_DIR/signal_processor_simd.wasm" \
+       "$CPP_DIR/signal_processor_worklet.js" \
+       "$CPP_DIR/signal_processor_worklet.wasm" \
+       "$CPP_DIR/signal_processor_threads.js" \
+       "$CPP_DIR/signal_processor_threads.wasm" \
+       "$CPP_DIR/mfcc_bench.js" \
+       "$CPP_DIR/mfcc_bench.wasm" \
+       "$CPP_DIR/mfcc_golden.js" \
+       "$CPP_DIR/mfcc_golden.wasm" \
+       "$CPP_DIR/mfcc_golden_simd.js" \
+       "$CPP_DIR/mfcc_golden_simd.wasm"
 
 echo "=== Creating build directory ==="
 cd "$CPP_DIR"
@@ -38,7 +50,11 @@ echo "=== Setting up wasm directory ==="
 mkdir -p "$ROOT_DIR/src/wasm"
 
 echo "=== Copying build artifacts to wasm directory ==="
-cp "$CPP_DIR/signal_processor.js" "$CPP_DIR/signal_processor.wasm" "$ROOT_DIR/src/wasm/"
+cp "$CPP_DIR/signal_processor.js" "$CPP_DIR/signal_processor.wasm" \
+   "$CPP_DIR/signal_processor_simd.js" "$CPP_DIR/signal_processor_simd.wasm" \
+   "$CPP_DIR/signal_processor_worklet.js" "$CPP_DIR/signal_processor_worklet.wasm" \
+   "$CPP_DIR/signal_processor_threads.js" "$CPP_DIR/signal_processor_threads.wasm" \
+   "$ROOT_DIR/src/wasm/"
 
 echo "=== Build complete ==="
 echo "Files copied to: $ROOT_DIR/src/wasm"
@@ -1,7 +1,16 @@
 import { useState, useEffect, useRef } from 'react';
 import { WebGLSpectrogramRenderer } from './webglRenderer';
+import { createMfccWorklet, workletSupported } from './mfccWorklet';
+import { PerfMonitor } from './perfStats';
+import { loadSignalProcessor } from './wasmLoader';
+import { ProcessingBudget } from './processingBudget';
 import './App.css';
 
+const COEFFICIENT_COUNT = 13;
+const HISTORY_LENGTH = 300;
+// React only needs the bar values a few times per second
+const COEFFICIENT_STATE_INTERVAL_MS = 100;
+
 function App() {
   const [wasmModule, setWasmModule] = useState(null);
   const [isProcessing, setIsProcessing] = useState(true);
@@ -20,11 +29,36 @@ function App() {
   // Global scaling factor to adjust overall sensitivity
   const [globalScaling, setGlobalScaling] = useState(1.0);
 
+  // Post-DCT normalization done in WASM: 'FixedRange' (sensitivity sliders),
+  // 'Cmvn' (running mean/variance) or 'MinMax' (decaying per-coefficient range)
+  const [normalizationMode, setNormalizationMode] = useState('FixedRange');
+
+  // Live perf overlay (DSP stages vs marshalling vs rendering)
+  const [showPerf, setShowPerf] = useState(false);
+  const [perfSnapshot, setPerfSnapshot] = useState(null);
+
+  // Quality tier the main-thread loop is running at (null on the worklet path)
+  const [qualityTier, setQualityTier] = useState(null);
+
   // Refs for audio processing
   const audioContextRef = useRef(null);
   const processorRef = useRef(null);
   const analyzerRef = useRef(null);
   const sourceRef = useRef(null);
+  const inputViewRef = useRef(null);
+  const outputViewRef = useRef(null);
+  const workletRef = useRef(null);
+  const showPerfRef = useRef(false);
+  const perfMonitorRef = useRef(new PerfMonitor());
+  const perfStatsViewRef = useRef(null);
+  const lastPerfUpdateRef = useRef(0);
+  const historyViewRef = useRef(null);
+  const historyRendererRef = useRef(null);
+  const lastCoefficientUpdateRef = useRef(0);
+  const budgetRef = useRef(null);
+  if (!budgetRef.current) {
+    budgetRef.current = new ProcessingBudget();
+  }
 
   // Refs for WebGL rendering
   const canvasRef = useRef(null);
@@ -34,12 +68,12 @@ function App() {
   async function loadWasm() {
     try {
       console.log('Starting WASM load...');
-      const moduleFactory = await import('./wasm/signal_processor.js');
-      const Module = await moduleFactory.default();
+      const { Module, simd } = await loadSignalProcessor();
+      console.log(`Loaded ${simd ? 'SIMD128' : 'scalar'} signal processor`);
 
-      processorRef.current = new Module.SignalProcessor();
+      // The main-thread SignalProcessor is only created once we know the
+      // AudioWorklet path is unavailable (see startProcessing)
       setWasmModule(Module);
-      console.log('SignalProcessor created successfully');
     } catch (err) {
       console.error('WASM loading error:', err);
       setError('Failed to initialize audio processor: ' + err.message);
@@ -54,6 +88,9 @@ function App() {
       if (processorRef.current) {
         processorRef.current.delete();
       }
+      if (workletRef.current) {
+        workletRef.current.node.disconnect();
+      }
       if (audioContextRef.current) {
         audioContextRef.current.close();
       }
@@ -66,24 +103,61 @@ function App() {
     };
   }, []);
 
+  // Display value = coefficient * scale + offset, clamped to 0-100, applied
+  // in WASM by the history buffer of whichever processor produces the frames
+  const displayMapping = (index) => {
+    const sensitivity = index === 0 ? sensitivityC0 : index === 1 ? sensitivityC1 : sensitivityOthers;
+    return { scale: globalScaling * 50 / sensitivity, offset: 50 };
+  };
+
+  // Push the normalization mode and sensitivities into the history mapping:
+  // the worklet's processor when the worklet runs the DSP, otherwise the
+  // main-thread one
+  const applyDisplayMapping = () => {
+    if (workletRef.current) {
+      workletRef.current.setHistoryMapping({
+        mode: normalizationMode,
+        minValue: 0,
+        maxValue: 100,
+        coefficients: Array.from({ length: COEFFICIENT_COUNT }, (_, k) => displayMapping(k)),
+      });
+    } else {
+      applyHistoryMapping(processorRef.current);
+    }
+  };
+
+  // Push the current sensitivities into a main-thread processor's history mapping
+  const applyHistoryMapping = (processor) => {
+    if (!processor || processor.getHistoryLength() === 0) return;
+    const mode = wasmModule.NormalizationMode[normalizationMode];
+    if (processor.getNormalizationMode() !== mode) {
+      processor.setNormalizationMode(mode);
+    }
+    processor.setHistoryRange(0, 100);
+    for (let k = 0; k < COEFFICIENT_COUNT; k++) {
+      const { scale, offset } = displayMapping(k);
+      processor.setHistoryMapping(k, scale, offset);
+    }
+  };
+
+  // Throttled copy of the latest frame for React
+  const publishCoefficients = (frame) => {
+    const now = performance.now();
+    if (now - lastCoefficientUpdateRef.current < COEFFICIENT_STATE_INTERVAL_MS) return;
+    lastCoefficientUpdateRef.current = now;
+    setCoefficients(Array.from(frame));
+  };
+
   // Function to update the renderer with current visualization settings
   const updateRenderer = () => {
     if (!canvasRef.current) return;
     
-    // Destroy existing renderer if it exists
-    if (rendererRef.current) {
-      rendererRef.current.destroy();
-    }
-    
     // Fixed colors for low, mid, high
     const colorLow = [0, 0, 0.8, 1]; // Blue
     const colorMid = [0, 0.8, 0, 1]; // Green
     const colorHigh = [0.8, 0, 0, 1]; // Red
     
-    // Create new renderer with current settings
-    rendererRef.current = new WebGLSpectrogramRenderer(canvasRef.current, {
-      coefficientCount: 13,
-      historyLength: 300,
+    const options = {
       colorLow,
       colorMid,
       colorHigh,
@@ -92,21 +166,20 @@ function App() {
       // Threshold values used in the renderer
       thresholdLowMid: lowMidThreshold,
       thresholdMidHigh: midHighThreshold,
-      normalizeFunction: (value, index) => {
-        // Apply global scaling to all values
-        value = value * globalScaling;
-        
-        if (index === 0) {
-          // C0 (energy) with adjustable sensitivity
-          return Math.min(Math.max((value / sensitivityC0 + 1) * 50, 0), 100);
-        } else if (index === 1) {
-          // C1 with adjustable sensitivity
-          return Math.min(Math.max((value / sensitivityC1 + 1) * 50, 0), 100);
-        } else {
-          // Other coefficients with adjustable sensitivity
-          return Math.min(Math.max((value / sensitivityOthers + 1) * 50, 0), 100);
-        }
-      }
+    };
+    applyDisplayMapping();
+    
+    // Settings changes keep the renderer and the history already on the GPU
+    if (rendererRef.current) {
+      rendererRef.current.updateOptions(options);
+      return;
+    }
+    
+    // Create new renderer with current settings
+    rendererRef.current = new WebGLSpectrogramRenderer(canvasRef.current, {
+      coefficientCount: COEFFICIENT_COUNT,
+      historyLength: HISTORY_LENGTH,
+      ...options
     });
     
     // Start the render loop
@@ -163,6 +236,28 @@ function App() {
     }
   }, [lowMidThreshold, midHighThreshold, sensitivityC0, sensitivityC1, sensitivityOthers, globalScaling]);
 
+  useEffect(() => {
+    applyDisplayMapping();
+  }, [normalizationMode]);
+
+  // Turn the processor's counters on only while the overlay is visible; the
+  // processing budget times frames itself and does not need them
+  const applyInstrumentation = (enabled) => {
+    showPerfRef.current = enabled;
+    perfMonitorRef.current = new PerfMonitor();
+    if (workletRef.current) {
+      workletRef.current.setInstrumentationEnabled(enabled);
+    } else if (processorRef.current) {
+      processorRef.current.setInstrumentationEnabled(enabled);
+      if (enabled) processorRef.current.resetPerfStats();
+    }
+  };
+
+  useEffect(() => {
+    applyInstrumentation(showPerf);
+    if (!showPerf) setPerfSnapshot(null);
+  }, [showPerf]);
+
   // Effect to handle the audio processing loop separately from the state
   useEffect(() => {
     // Start audio processing when component mounts
@@ -179,6 +274,42 @@ function App() {
     };
   }, [isProcessing]);
 
+  // Builds the main-thread processor for a quality tier at the context rate.
+  // A processor being replaced hands its display history over, so the
+  // spectrogram carries on across tier changes.
+  const createProcessor = (tier) => {
+    const config = {
+      ...wasmModule.getDefaultConfig(),
+      sampleRate: audioContextRef.current.sampleRate,
+      frameLength: tier.frameLength,
+      fftSize: tier.fftSize,
+      numBands: tier.numBands,
+    };
+    // The analyser keeps twice the frame, as with the original 2048/1024 pair
+    analyzerRef.current.fftSize = 2 * tier.frameLength;
+
+    const previous = processorRef.current;
+    const processor = new wasmModule.SignalProcessor(config);
+    if (previous) {
+      processor.adoptHistory(previous);
+      previous.delete();
+    }
+    if (processor.getHistoryLength() === 0) {
+      // Frames land in a heap history buffer the renderer uploads from directly
+      processor.setHistoryLength(HISTORY_LENGTH);
+      applyHistoryMapping(processor);
+      historyViewRef.current = null;
+    }
+    processor.setInstrumentationEnabled(showPerfRef.current);
+    processorRef.current = processor;
+    inputViewRef.current = null;
+    outputViewRef.current = null;
+    perfStatsViewRef.current = null;
+    perfMonitorRef.current = new PerfMonitor();
+    setQualityTier(tier.name);
+    console.log(`SignalProcessor configured for ${config.sampleRate} Hz, ${tier.name}`);
+  };
+
   const startProcessing = async () => {
     if (!wasmModule || !rendererRef.current) {
       console.log('No WASM module or renderer available');
@@ -204,6 +335,34 @@ function App() {
         analyzerRef.current.fftSize = 2048;
         sourceRef.current.connect(analyzerRef.current);
         console.log('Connected source to analyzer');
+
+        // Prefer running the DSP inside an AudioWorklet; frames and display
+        // rows come back through SharedArrayBuffers and the analyser path
+        // stays as the fallback
+        const tier = budgetRef.current.tier;
+        if (workletSupported(audioContextRef.current)) {
+          try {
+            workletRef.current = await createMfccWorklet(audioContextRef.current, sourceRef.current, {
+              frameLength: tier.frameLength,
+              fftSize: tier.fftSize,
+            }, {
+              historyLength: HISTORY_LENGTH,
+              // Devices without float textures get bytes quantized in WASM
+              quantized: rendererRef.current.useUint8,
+            });
+            console.log('Processing in AudioWorklet');
+            perfStatsViewRef.current = workletRef.current.reader.stats;
+            applyDisplayMapping();
+          } catch (err) {
+            console.warn('AudioWorklet processing unavailable, using main thread:', err);
+            workletRef.current = null;
+          }
+        }
+        if (!workletRef.current) {
+          // Build the processor tables for the real context rate and frame size
+          createProcessor(tier);
+        }
+        applyInstrumentation(showPerfRef.current);
       }
 
       // Set processing state
@@ -219,34 +378,91 @@ function App() {
         if (!isProcessing) return;
 
         try {
-          const buffer = new Float32Array(analyzerRef.current.frequencyBinCount);
-          analyzerRef.current.getFloatTimeDomainData(buffer);
-
-          const inputVector = new wasmModule.FloatVector();
-          buffer.forEach(sample => inputVector.push_back(sample));
+          const perf = showPerfRef.current ? perfMonitorRef.current : null;
+
+          if (workletRef.current) {
+            const { reader, history } = workletRef.current;
+            // Frames were produced on the audio thread at the hop rate; the
+            // UI only needs the newest one
+            let latest = null;
+            reader.drain((frame) => {
+              latest = frame;
+            });
+            if (latest) {
+              publishCoefficients(latest);
+            }
+            // Display rows were normalized in the worklet's WASM history and
+            // mirrored into shared memory; upload the new ones from there
+            if (rendererRef.current) {
+              if (historyRendererRef.current !== rendererRef.current) {
+                rendererRef.current.attachHistory(history.values, history.bytes);
+                historyRendererRef.current = rendererRef.current;
+              }
+              const t0 = perf ? performance.now() : 0;
+              const written = history.framesWritten;
+              rendererRef.current.updateFromHistory(written % history.numRows, written);
+              if (perf) perf.addRender(performance.now() - t0);
+            }
+            updatePerfOverlay(perf, reader.overruns);
+            return;
+          }
 
-          const results = processorRef.current.processSamples(inputVector);
+          // Frames skipped by the processing budget only update the overlay
+          const budget = budgetRef.current;
+          if (!budget.shouldProcess()) {
+            updatePerfOverlay(perf, 0);
+            return;
+          }
 
-          // Convert to regular array
-          // WASM HARDCODED TO RETURN 13 COEFFICIENTS; STANDARD FOR CEPSTRAL
-          const resultsArray = [];
-          for (let i = 0; i < results.size(); i++) {
-            resultsArray.push(results.get(i));
+          // Heap-resident views owned by the processor; re-fetch them only if
+          // they were detached by a heap resize or the processor was rebuilt
+          if (!inputViewRef.current || inputViewRef.current.byteLength === 0) {
+            inputViewRef.current = processorRef.current.getInputView();
+            outputViewRef.current = processorRef.current.getOutputView();
+            perfStatsViewRef.current = processorRef.current.getPerfStatsView();
+            historyViewRef.current = processorRef.current.getHistoryView();
+            historyRendererRef.current = null;
           }
+          // A new renderer (settings change) or view needs attaching once
+          if (rendererRef.current && historyRendererRef.current !== rendererRef.current) {
+            // Devices without float textures get bytes quantized in WASM
+            processorRef.current.setHistoryQuantized(rendererRef.current.useUint8);
+            rendererRef.current.attachHistory(historyViewRef.current, processorRef.current.getHistoryBytesView());
+            historyRendererRef.current = rendererRef.current;
+          }
+
+          // The analyser writes straight into the WASM input buffer
+          const t0 = performance.now();
+          analyzerRef.current.getFloatTimeDomainData(inputViewRef.current);
+          const t1 = performance.now();
+          processorRef.current.processInPlace();
+          const t2 = performance.now();
 
-          if (resultsArray.length > 0) {
-            // Update both local state for bar display and WebGL renderer
-            setCoefficients(resultsArray);
+          const results = outputViewRef.current;
 
-            // Update WebGL renderer with new data
+          if (results.length > 0) {
+            // React state needs its own copy, taken at a throttled rate
+            publishCoefficients(results);
+            const t3 = performance.now();
+
+            // Upload the new history rows straight from WASM memory
             if (rendererRef.current) {
-              rendererRef.current.updateData(resultsArray);
+              rendererRef.current.updateFromHistory(
+                processorRef.current.getHistoryWriteRow(),
+                processorRef.current.getHistoryFramesWritten()
+              );
+            }
+            const t4 = performance.now();
+            if (perf) {
+              perf.addMarshal((t1 - t0) + (t3 - t2));
+              perf.addRender(t4 - t3);
+            }
+            // The whole frame is budgeted, not just the DSP call
+            if (budget.record(t4 - t0)) {
+              createProcessor(budget.tier);
             }
           }
-
-          // Clean up WASM vectors
-          inputVector.delete();
-          results.delete();
+          updatePerfOverlay(perf, 0);
         } catch (err) {
           console.error('Processing error:', err);
           setError('Processing error occurred: ' + err.message);
@@ -267,6 +483,16 @@ function App() {
     }
   };
 
+  // Publishes per-frame averages to the overlay a few times per second so the
+  // overlay itself does not add a React render per frame
+  const updatePerfOverlay = (perf, overruns) => {
+    if (!perf || !perfStatsViewRef.current) return;
+    const now = performance.now();
+    if (now - lastPerfUpdateRef.current < 500) return;
+    lastPerfUpdateRef.current = now;
+    setPerfSnapshot(perf.snapshot(perfStatsViewRef.current, overruns));
+  };
+
   const stopProcessing = () => {
     setIsProcessing(false);
 
@@ -360,6 +586,17 @@ function App() {
           >
             Reset
           </button>
+
+          <label className="perf-toggle">
+            <input
+              type="checkbox"
+              checked={showPerf}
+              onChange={(e) => setShowPerf(e.target.checked)}
+            />
+            Perf overlay
+          </label>
+
+          {qualityTier && <span className="quality-tier">Quality: {qualityTier}</span>}
         </div>
 
         {error && <div className="error-message">{error}</div>}
@@ -422,6 +659,18 @@ function App() {
           <div className="control-section">
             <h3>Sensitivity Controls</h3>
             <div className="sensitivity-controls">
+              <div className="control-group">
+                <label>Normalization:</label>
+                <select
+                  value={normalizationMode}
+                  onChange={(e) => setNormalizationMode(e.target.value)}
+                  className="preset-select"
+                >
+                  <option value="FixedRange">Fixed (sensitivity)</option>
+                  <option value="Cmvn">Running mean/variance</option>
+                  <option value="MinMax">Running min/max</option>
+                </select>
+              </div>
               <div className="control-group">
                 <label>Global Scaling:</label>
                 <input 
@@ -473,6 +722,18 @@ function App() {
 
         {/* WebGL spectrogram canvas */}
         <div className="spectrogram-container">
+          {showPerf && perfSnapshot && (
+            <div className="perf-overlay">
+              <div>DSP {perfSnapshot.dspMs.toFixed(3)} ms/frame (max {perfSnapshot.maxFrameMs.toFixed(3)})</div>
+              <div>
+                {Object.entries(perfSnapshot.stages)
+                  .map(([name, ms]) => `${name} ${ms.toFixed(3)}`)
+                  .join(' · ')}
+              </div>
+              <div>Marshal {perfSnapshot.marshalMs.toFixed(3)} ms · Render {perfSnapshot.renderMs.toFixed(3)} ms</div>
+              <div>{perfSnapshot.frames} frames · dropped {perfSnapshot.dropped} · overruns {perfSnapshot.overruns}</div>
+            </div>
+          )}
           <canvas
             ref={canvasRef}
             className="spectrogram-canvas"
@@ -0,0 +1,56 @@
+#include "alloc_counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+std::atomic<size_t> allocations{0};
+}
+
+namespace alloc_counter {
+
+bool enabled() {
+#ifdef SIGNAL_PROCESSOR_COUNT_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+size_t count() { return allocations.load(std::memory_order_relaxed); }
+
+}  // namespace alloc_counter
+
+#ifdef SIGNAL_PROCESSOR_COUNT_ALLOCATIONS
+
+// Replacements for the global allocation functions; every other form of
+// operator new/delete forwards to these.
+static void* countedAlloc(size_t size, size_t alignment) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (size == 0) size = 1;
+    void* p = nullptr;
+    if (alignment <= alignof(std::max_align_t)) {
+        p = std::malloc(size);
+    } else {
+        size = (size + alignment - 1) / alignment * alignment;
+        p = std::aligned_alloc(alignment, size);
+    }
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new(size_t size) { return countedAlloc(size, alignof(std::max_align_t)); }
+void* operator new[](size_t size) { return countedAlloc(size, alignof(std::max_align_t)); }
+void* operator new(size_t size, std::align_val_t al) { return countedAlloc(size, static_cast<size_t>(al)); }
+void* operator new[](size_t size, std::align_val_t al) { return countedAlloc(size, static_cast<size_t>(al)); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+
+#endif
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstddef>
+
+// Debug counter of global operator new calls, used to check that the
+// steady-state frame path does not allocate. Only counts when built with
+// SIGNAL_PROCESSOR_COUNT_ALLOCATIONS (CMake option of the same name),
+// otherwise the counter stays at zero.
+namespace alloc_counter {
+
+bool enabled();
+size_t count();
+
+}  // namespace alloc_counter
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <complex>
+
+#include "processor_config.h"
+
+// Tables for the default shape (ProcessorConfig() at the usual AudioContext
+// rates), generated ahead of time by native/gen_default_tables.cpp from the
+// same builders and compiled into the binary as constants, so constructing a
+// default processor does no trigonometry. Each lookup returns false/null for
+// any other shape and the caller builds the table as usual.
+//
+// The generator itself is built with SIGNAL_PROCESSOR_NO_BAKED_TABLES so it
+// sees the runtime builders; the check_default_tables target rebuilds the
+// tables that way and fails when default_tables_data.h is stale.
+
+struct BakedMelTable {
+    float sampleRate;
+    int fftSize;
+    int numBands;
+    float fMin;
+    float fMax;
+    const int* spans;       // startBin, endBin, weightOffset per band
+    const float* weights;
+    int numWeights;
+};
+
+#ifndef SIGNAL_PROCESSOR_NO_BAKED_TABLES
+#include "default_tables_data.h"
+#endif
+
+namespace baked_tables {
+
+#ifdef SIGNAL_PROCESSOR_NO_BAKED_TABLES
+
+inline bool twiddle(int, int, std::complex<float>&) { return false; }
+inline const float* window(WindowType, int) { return nullptr; }
+inline const BakedMelTable* melFilterbank(int, float, int, float, float) { return nullptr; }
+inline const float* dctBasis(int, int) { return nullptr; }
+
+#else
+
+// fftTwiddle(j, len) for a power-of-2 len. Every stage's root is a power of
+// the largest one, and -2πj/len only differs from -2π(jk)/(len k) by the
+// power-of-2 factor k, so one table of the top stage covers all of them
+// exactly.
+inline bool twiddle(int j, int len, std::complex<float>& out) {
+    using namespace default_tables;
+    if (len < 2 || len > kTwiddleSize || (len & (len - 1)) != 0 || j < 0 || 2 * j >= len) {
+        return false;
+    }
+    int index = j * (kTwiddleSize / len);
+    out = std::complex<float>(kTwiddles[2 * index], kTwiddles[2 * index + 1]);
+    return true;
+}
+
+inline const float* window(WindowType type, int n) {
+    if (type == WindowType::Hamming && n == default_tables::kWindowLength) return default_tables::kHammingWindow;
+    return nullptr;
+}
+
+inline const BakedMelTable* melFilterbank(int fftSize, float sampleRate, int numBands, float fMin, float fMax) {
+    for (const BakedMelTable& table : default_tables::kMelTables) {
+        if (table.fftSize == fftSize && table.sampleRate == sampleRate && table.numBands == numBands &&
+            table.fMin == fMin && table.fMax == fMax) {
+            return &table;
+        }
+    }
+    return nullptr;
+}
+
+// Row-major numCoeffs x numInputs mat-vec basis
+inline const float* dctBasis(int numInputs, int numCoeffs) {
+    if (numInputs == default_tables::kDctInputs && numCoeffs == default_tables::kDctCoeffs) {
+        return default_tables::kDctBasis;
+    }
+    return nullptr;
+}
+
+#endif
+
+}  // namespace baked_tables
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <chrono>
+
+// Timing helpers shared by the benchmark programs
+
+namespace bench {
+
+using Clock = std::chrono::steady_clock;
+
+// Keeps the timed loops from being optimized away
+inline volatile float sink = 0.0f;
+
+// Runs fn repeatedly, doubling the repetition count until one batch takes at
+// least minSeconds, and returns the mean nanoseconds per call of that batch
+template <typename Fn>
+double timeNsPerCall(Fn fn, double minSeconds) {
+    long reps = 1;
+    for (;;) {
+        Clock::time_point start = Clock::now();
+        for (long r = 0; r < reps; r++) {
+            fn();
+        }
+        double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        if (elapsed >= minSeconds || reps >= (1L << 30)) {
+            return elapsed * 1e9 / reps;
+        }
+        reps *= 2;
+    }
+}
+
+}  // namespace bench
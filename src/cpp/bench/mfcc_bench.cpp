@@ -0,0 +1,368 @@
+// Benchmark of the MFCC pipeline with per-stage timings.
+// Times window+pack, FFT, power spectrum, mel, log and DCT separately, the
+// sliding DFT spectrum engine against window+pack+FFT at hops of 1 and 2
+// samples, and the full SignalProcessor frame path (with and without the
+// compile-time MfccPipeline where the shape has one) for a grid of FFT sizes
+// and band counts, plus a stereo MultiChannelProcessor row, and prints the
+// results as JSON. The same source builds natively and as a WASM
+// program run headless under Node (see CMakeLists.txt).
+//
+// Usage: mfcc_bench [--min-time-ms MS] [--fft N]... [--bands N]... [--output FILE]
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "signal_processor.h"
+#include "multi_channel_processor.h"
+#include "bench_timing.h"
+
+namespace {
+
+using bench::sink;
+using bench::timeNsPerCall;
+
+struct StageTimings {
+    double windowPack = 0.0;    // packWindowed: window, zero-pad and pack for the real FFT
+    double fft = 0.0;
+    double power = 0.0;
+    double mel = 0.0;
+    double log = 0.0;       // kPrecision, what this build ships
+    double logFast = 0.0;   // Precision::Fast, for comparison in any build
+    double dct = 0.0;
+};
+
+// Spectrum of one streamed frame: what pushSamples() spends before the power
+// stage with either engine
+struct SpectrumTimings {
+    double fft = 0.0;            // packWindowed + transformPacked
+    double slidingDftHop1 = 0.0; // push 1 sample + windowedSpectrum + amortized resync
+    double slidingDftHop2 = 0.0;
+};
+
+struct BenchResult {
+    ProcessorConfig config;
+    StageTimings stages;
+    SpectrumTimings spectrum;
+    double nsPerFrame = 0.0;    // full processBatch path
+    double allocationsPerFrame = 0.0;
+    bool specialized = false;   // processBatch ran a compile-time MfccPipeline
+    double runtimeNsPerFrame = 0.0; // same batch with setUseSpecialized(false)
+};
+
+std::vector<float> makeSignal(size_t length, float sampleRate) {
+    std::vector<float> signal(length);
+    for (size_t i = 0; i < length; i++) {
+        float t = static_cast<float>(i) / sampleRate;
+        signal[i] = 0.5f * std::sin(2.0f * static_cast<float>(M_PI) * 440.0f * t) +
+                    0.25f * std::sin(2.0f * static_cast<float>(M_PI) * 3150.0f * t) +
+                    0.05f * static_cast<float>((i * 2654435761u) % 1000) / 1000.0f;
+    }
+    return signal;
+}
+
+// Runs each stage on its own over one frame with the same plans and kernels
+// SignalProcessor's real-FFT path uses: the window is fused into the packing
+// load (packWindowed), then the packed transform runs in place.
+StageTimings benchStages(const ProcessorConfig& config, const std::vector<float>& frame,
+                         double minSeconds) {
+    int n = config.fftSize;
+    int numBins = n / 2 + 1;
+
+    std::vector<float> window = buildWindow(config.windowType, config.frameLength);
+    RealFftPlan fftPlan(n);
+    MelFilterbank melFilterbank(n, config.sampleRate, config.numBands, config.fMin, config.fMax);
+    DctPlan dctPlan(config.numBands, config.numCoeffs);
+
+    std::vector<std::complex<float>> packed(n / 2);
+    std::vector<std::complex<float>> spectrum(numBins);
+    std::vector<float> power(numBins);
+    std::vector<float> mel(config.numBands);
+    std::vector<float> logMel(config.numBands);
+    std::vector<float> coeffs(config.numCoeffs);
+    std::vector<std::complex<float>> dctScratch(dctPlan.getScratchSize());
+
+    StageTimings t;
+    t.windowPack = timeNsPerCall([&]() {
+        packWindowed(frame.data(), window.data(), config.frameLength, n / 2, packed.data());
+        sink = packed[0].real();
+    }, minSeconds);
+    // The transform is in place, so each call starts from a copy of the packed frame
+    t.fft = timeNsPerCall([&]() {
+        std::copy(packed.begin(), packed.end(), spectrum.begin());
+        fftPlan.transformPacked(spectrum.data());
+        sink = spectrum[1].real();
+    }, minSeconds);
+    t.power = timeNsPerCall([&]() {
+        kernels::complexNorm(spectrum.data(), power.data(), numBins);
+        sink = power[1];
+    }, minSeconds);
+    t.mel = timeNsPerCall([&]() {
+        melFilterbank.apply(power.data(), numBins, mel.data());
+        sink = mel[0];
+    }, minSeconds);
+    t.log = timeNsPerCall([&]() {
+        std::copy(mel.begin(), mel.end(), logMel.begin());
+        kernels::logFloor<kPrecision>(logMel.data(), 1e-10f, config.numBands);
+        sink = logMel[0];
+    }, minSeconds);
+    t.logFast = timeNsPerCall([&]() {
+        std::copy(mel.begin(), mel.end(), logMel.begin());
+        kernels::logFloor<Precision::Fast>(logMel.data(), 1e-10f, config.numBands);
+        sink = logMel[0];
+    }, minSeconds);
+    std::copy(mel.begin(), mel.end(), logMel.begin());
+    kernels::logFloor<kPrecision>(logMel.data(), 1e-10f, config.numBands);
+    t.dct = timeNsPerCall([&]() {
+        dctPlan.apply(logMel.data(), coeffs.data(), dctScratch.data());
+        sink = coeffs[0];
+    }, minSeconds);
+    return t;
+}
+
+// Times SlidingDft directly so both hops are measured whatever
+// slidingDftMaxHop() allows for this build
+SpectrumTimings benchSpectrum(const ProcessorConfig& config, const std::vector<float>& signal,
+                              double fftNs, double minSeconds) {
+    SpectrumTimings t;
+    t.fft = fftNs;
+
+    ProcessorConfig slidingConfig = config;
+    if (slidingDftCosineTerms(slidingConfig.windowType) == 0) slidingConfig.windowType = WindowType::Hamming;
+    SlidingDft slidingDft(slidingConfig);
+    FftPlan fullPlan(config.fftSize);
+    std::vector<std::complex<float>> spectrum(config.fftSize);
+
+    double resyncNs = timeNsPerCall([&]() {
+        slidingDft.resync(signal.data(), fullPlan, spectrum.data());
+        sink = spectrum[1].real();
+    }, minSeconds);
+    double windowedNs = timeNsPerCall([&]() {
+        slidingDft.windowedSpectrum(spectrum.data());
+        sink = spectrum[1].real();
+    }, minSeconds);
+    size_t pos = 0;
+    double pushNs = timeNsPerCall([&]() {
+        if (pos + 2 > signal.size()) pos = 0;
+        slidingDft.push(signal.data() + pos, 2);
+        pos += 2;
+        sink = signal[pos];
+    }, minSeconds) / 2.0;
+
+    double perFrame = windowedNs + resyncNs / config.slidingDftResync;
+    t.slidingDftHop1 = pushNs + perFrame;
+    t.slidingDftHop2 = 2.0 * pushNs + perFrame;
+    return t;
+}
+
+BenchResult benchConfig(int fftSize, int numBands, double minSeconds) {
+    ProcessorConfig requested;
+    requested.sampleRate = 44100.0f;
+    requested.frameLength = fftSize;
+    requested.fftSize = fftSize;
+    requested.hopLength = fftSize / 2;
+    requested.numBands = numBands;
+
+    BenchResult result;
+    SignalProcessor processor(requested);
+    result.config = processor.getConfig();
+    result.specialized = processor.getUseSpecialized();
+    const ProcessorConfig& config = result.config;
+
+    const int numFrames = 64;
+    std::vector<float> signal =
+        makeSignal(static_cast<size_t>(numFrames - 1) * config.hopLength + config.frameLength, config.sampleRate);
+    std::vector<float> features(static_cast<size_t>(numFrames) * config.numCoeffs);
+
+    result.stages = benchStages(config, signal, minSeconds);
+    result.spectrum = benchSpectrum(config, signal, result.stages.windowPack + result.stages.fft, minSeconds);
+
+    // Warm up once so one-time work is not counted as per-frame cost, then
+    // count allocations over a single batch
+    processor.processBatch(signal.data(), numFrames, config.hopLength, features.data());
+    size_t allocationsBefore = alloc_counter::count();
+    processor.processBatch(signal.data(), numFrames, config.hopLength, features.data());
+    result.allocationsPerFrame =
+        static_cast<double>(alloc_counter::count() - allocationsBefore) / numFrames;
+
+    double nsPerBatch = timeNsPerCall([&]() {
+        processor.processBatch(signal.data(), numFrames, config.hopLength, features.data());
+        sink = features[0];
+    }, minSeconds);
+    result.nsPerFrame = nsPerBatch / numFrames;
+
+    processor.setUseSpecialized(false);
+    double runtimeNsPerBatch = timeNsPerCall([&]() {
+        processor.processBatch(signal.data(), numFrames, config.hopLength, features.data());
+        sink = features[0];
+    }, minSeconds);
+    result.runtimeNsPerFrame = runtimeNsPerBatch / numFrames;
+    return result;
+}
+
+// Stereo MultiChannelProcessor on the default shape
+struct StereoResult {
+    ProcessorConfig config;
+    // Mel filterbank, log and DCT mat-vec on the bin-major SoA buffers with
+    // the channel stride left at 2 or padded to 4 (what the processor runs,
+    // with the log skipping the padding lanes)
+    double melDctStride2 = 0.0;
+    double melDctStride4 = 0.0;
+    double nsPerFrame = 0.0;              // processBatchPlanar, both channels
+    double twoProcessorsNsPerFrame = 0.0; // one SignalProcessor per channel
+};
+
+StereoResult benchStereo(double minSeconds) {
+    const int numChannels = 2;
+    const int numFrames = 64;
+    ProcessorConfig requested;
+    requested.sampleRate = 44100.0f;
+
+    StereoResult result;
+    MultiChannelProcessor stereo(requested, numChannels);
+    result.config = stereo.getConfig();
+    const ProcessorConfig& config = result.config;
+    int numBins = config.fftSize / 2 + 1;
+
+    MelFilterbank melFilterbank(config.fftSize, config.sampleRate, config.numBands, config.fMin, config.fMax);
+    DctPlan dctPlan(config.numBands, config.numCoeffs);
+    auto melDct = [&](int stride) {
+        std::vector<float> power(static_cast<size_t>(numBins) * stride, 1.0f);
+        std::vector<float> mel(static_cast<size_t>(config.numBands) * stride);
+        std::vector<float> coeffs(static_cast<size_t>(config.numCoeffs) * stride);
+        const std::vector<float>& weights = melFilterbank.getWeights();
+        const std::vector<float>& basis = dctPlan.getBasis();
+        return timeNsPerCall([&]() {
+            for (int b = 0; b < config.numBands; b++) {
+                const MelFilterbank::Band& band = melFilterbank.getBands()[b];
+                int length = std::max(0, std::min(band.endBin, numBins) - band.startBin);
+                kernels::weightedColumnSum(power.data() + band.startBin * stride, stride,
+                                           weights.data() + band.weightOffset, length,
+                                           mel.data() + b * stride, stride);
+            }
+            if (stride == numChannels) {
+                kernels::logFloor<kPrecision>(mel.data(), 1e-10f, config.numBands * stride);
+            } else {
+                for (int b = 0; b < config.numBands; b++) {
+                    kernels::logFloor<kPrecision>(mel.data() + b * stride, 1e-10f, numChannels);
+                }
+            }
+            for (int k = 0; k < config.numCoeffs; k++) {
+                kernels::weightedColumnSum(mel.data(), stride, basis.data() + k * config.numBands,
+                                           config.numBands, coeffs.data() + k * stride, stride);
+            }
+            sink = coeffs[0];
+        }, minSeconds);
+    };
+    result.melDctStride2 = melDct(numChannels);
+    result.melDctStride4 = melDct(4);
+
+    size_t channelLength = static_cast<size_t>(numFrames - 1) * config.hopLength + config.frameLength;
+    std::vector<float> planar = makeSignal(channelLength * numChannels, config.sampleRate);
+    std::vector<float> features(static_cast<size_t>(numFrames) * stereo.getFrameStride());
+    result.nsPerFrame = timeNsPerCall([&]() {
+        stereo.processBatchPlanar(planar.data(), static_cast<int>(channelLength), numFrames, config.hopLength,
+                                  features.data());
+        sink = features[0];
+    }, minSeconds) / numFrames;
+
+    SignalProcessor left(config);
+    SignalProcessor right(config);
+    result.twoProcessorsNsPerFrame = timeNsPerCall([&]() {
+        left.processBatch(planar.data(), numFrames, config.hopLength, features.data());
+        right.processBatch(planar.data() + channelLength, numFrames, config.hopLength,
+                           features.data() + static_cast<size_t>(numFrames) * config.numCoeffs);
+        sink = features[0];
+    }, minSeconds) / numFrames;
+    return result;
+}
+
+void writeJson(FILE* out, const std::vector<BenchResult>& results, const StereoResult& stereo,
+               double minSeconds) {
+    std::fprintf(out, "{\n");
+    std::fprintf(out, "  \"platform\": \"%s\",\n",
+#ifdef __EMSCRIPTEN__
+                 "wasm"
+#else
+                 "native"
+#endif
+    );
+    std::fprintf(out, "  \"simd\": %s,\n", kernels::kSimdEnabled ? "true" : "false");
+    std::fprintf(out, "  \"precision\": \"%s\",\n", kPrecision == Precision::Fast ? "fast" : "exact");
+    std::fprintf(out, "  \"allocationCounting\": %s,\n", alloc_counter::enabled() ? "true" : "false");
+    std::fprintf(out, "  \"minTimeMs\": %.1f,\n", minSeconds * 1e3);
+    std::fprintf(out, "  \"results\": [\n");
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchResult& r = results[i];
+        const StageTimings& s = r.stages;
+        std::fprintf(out,
+            "    {\"fftSize\": %d, \"numBands\": %d, \"numCoeffs\": %d, \"sampleRate\": %.0f,\n"
+            "     \"stagesNsPerFrame\": {\"windowPack\": %.1f, \"fft\": %.1f, \"power\": %.1f, "
+            "\"mel\": %.1f, \"log\": %.1f, \"logFast\": %.1f, \"dct\": %.1f},\n"
+            "     \"spectrumNsPerFrame\": {\"fft\": %.1f, \"slidingDftHop1\": %.1f, \"slidingDftHop2\": %.1f},\n"
+            "     \"nsPerFrame\": %.1f, \"framesPerSec\": %.1f, \"allocationsPerFrame\": %.3f,\n"
+            "     \"specialized\": %s, \"runtimeNsPerFrame\": %.1f}%s\n",
+            r.config.fftSize, r.config.numBands, r.config.numCoeffs, r.config.sampleRate,
+            s.windowPack, s.fft, s.power, s.mel, s.log, s.logFast, s.dct,
+            r.spectrum.fft, r.spectrum.slidingDftHop1, r.spectrum.slidingDftHop2,
+            r.nsPerFrame, 1e9 / r.nsPerFrame, r.allocationsPerFrame,
+            r.specialized ? "true" : "false", r.runtimeNsPerFrame,
+            i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(out, "  ],\n");
+    std::fprintf(out,
+        "  \"stereo\": {\"fftSize\": %d, \"numBands\": %d, \"numCoeffs\": %d,\n"
+        "    \"melDctNsPerFrame\": {\"stride2\": %.1f, \"stride4\": %.1f},\n"
+        "    \"nsPerFrame\": %.1f, \"twoProcessorsNsPerFrame\": %.1f}\n",
+        stereo.config.fftSize, stereo.config.numBands, stereo.config.numCoeffs,
+        stereo.melDctStride2, stereo.melDctStride4, stereo.nsPerFrame, stereo.twoProcessorsNsPerFrame);
+    std::fprintf(out, "}\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    double minSeconds = 0.02;
+    std::vector<int> fftSizes;
+    std::vector<int> bandCounts;
+    const char* outputPath = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::fprintf(stderr, "Usage: mfcc_bench [--min-time-ms MS] [--fft N]... [--bands N]... [--output FILE]\n");
+            return 1;
+        }
+        const char* value = argv[++i];
+        if (arg == "--min-time-ms") minSeconds = std::atof(value) / 1e3;
+        else if (arg == "--fft") fftSizes.push_back(std::atoi(value));
+        else if (arg == "--bands") bandCounts.push_back(std::atoi(value));
+        else if (arg == "--output") outputPath = value;
+        else {
+            std::fprintf(stderr, "Unknown option: %s\n", arg.c_str());
+            return 1;
+        }
+    }
+    if (fftSizes.empty()) fftSizes = {256, 512, 1024, 2048, 4096, 8192};
+    if (bandCounts.empty()) bandCounts = {20, 40, 64, 128};
+
+    std::vector<BenchResult> results;
+    for (int fftSize : fftSizes) {
+        for (int numBands : bandCounts) {
+            results.push_back(benchConfig(fftSize, numBands, minSeconds));
+        }
+    }
+
+    FILE* out = outputPath ? std::fopen(outputPath, "w") : stdout;
+    if (!out) {
+        std::fprintf(stderr, "Cannot write %s\n", outputPath);
+        return 1;
+    }
+    writeJson(out, results, benchStereo(minSeconds), minSeconds);
+    if (outputPath) std::fclose(out);
+    return 0;
+}
@@ -0,0 +1,711 @@
+// Golden-output regression and throughput harness.
+// Runs a fixed corpus of synthetic signals through every SignalProcessor
+// backend this build has (complex FFT, real FFT, the compile-time pipeline,
+// the thread pool, streaming, the sliding DFT stream engine,
+// MultiChannelProcessor and, on the normalized shape, the display history)
+// and compares each frame against a double-precision reference MFCC, deltas
+// and normalizer written independently of the pipeline code. Prints
+// per-backend errors, ns/frame and a checksum of the output as JSON, and
+// exits with 1 when any backend is outside its tolerance.
+//
+// Build-wide variants (SIMD128, SIGNAL_PROCESSOR_FAST_MATH) are separate
+// targets of the same source and run every shape; the checksum lets two
+// builds that promise bit-compatible output (native and scalar WASM) be
+// compared directly.
+//
+// Usage: mfcc_golden [--min-time-ms MS] [--no-timing] [--output FILE]
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "signal_processor.h"
+#include "multi_channel_processor.h"
+#include "bench_timing.h"
+
+namespace {
+
+using bench::sink;
+using bench::timeNsPerCall;
+
+// Max abs coefficient error allowed against the reference. Float rounding
+// costs the backends up to about 2e-4 on this corpus, in the exact, SIMD and
+// fast-log builds alike. Display values are checked in the same units:
+// their error is divided by the scale the normalizer mapped them with.
+constexpr double kTolerance = 1e-3;
+
+// Frames per corpus signal
+constexpr int kNumFrames = 48;
+// Block size of streamed pushes, one AudioWorklet render quantum
+constexpr int kPushBlock = 128;
+
+// ---------------------------------------------------------------------------
+// Reference MFCC: same definition as the pipeline (symmetric window,
+// zero-padded DFT, triangular mel bands with the same bin edges, log floor
+// 1e-10, orthonormal DCT-II), everything in double.
+
+class ReferenceMfcc {
+public:
+    explicit ReferenceMfcc(const ProcessorConfig& config)
+        : config(config), numBins(config.fftSize / 2 + 1) {
+        int n = config.frameLength;
+        window.assign(n, 1.0);
+        for (int i = 0; i < n && n > 1; i++) {
+            double phase = 2.0 * M_PI * i / (n - 1);
+            switch (config.windowType) {
+                case WindowType::Hamming:  window[i] = 0.54 - 0.46 * std::cos(phase); break;
+                case WindowType::Hann:     window[i] = 0.5 - 0.5 * std::cos(phase); break;
+                case WindowType::Blackman: window[i] = 0.42 - 0.5 * std::cos(phase) + 0.08 * std::cos(2.0 * phase); break;
+                case WindowType::Povey:    window[i] = std::pow(0.5 - 0.5 * std::cos(phase), 0.85); break;
+            }
+        }
+
+        buildFilterbank();
+
+        dctBasis.resize(static_cast<size_t>(config.numCoeffs) * config.numBands);
+        for (int k = 0; k < config.numCoeffs; k++) {
+            double scale = k == 0 ? std::sqrt(1.0 / config.numBands) : std::sqrt(2.0 / config.numBands);
+            for (int b = 0; b < config.numBands; b++) {
+                dctBasis[k * config.numBands + b] = scale * std::cos(M_PI * k * (2 * b + 1) / (2.0 * config.numBands));
+            }
+        }
+    }
+
+    void compute(const float* frame, double* coeffs) const {
+        int n = config.fftSize;
+        std::vector<std::complex<double>> spectrum(n);
+        for (int i = 0; i < config.frameLength; i++) {
+            spectrum[i] = frame[i] * window[i];
+        }
+        fft(spectrum);
+
+        std::vector<double> logMel(config.numBands);
+        for (int b = 0; b < config.numBands; b++) {
+            double energy = 0.0;
+            for (int j = 0; j < numBins; j++) {
+                energy += std::norm(spectrum[j]) * filters[static_cast<size_t>(b) * numBins + j];
+            }
+            logMel[b] = std::log(std::max(energy, 1e-10));
+        }
+        for (int k = 0; k < config.numCoeffs; k++) {
+            double sum = 0.0;
+            for (int b = 0; b < config.numBands; b++) {
+                sum += dctBasis[k * config.numBands + b] * logMel[b];
+            }
+            coeffs[k] = sum;
+        }
+    }
+
+private:
+    ProcessorConfig config;
+    int numBins;
+    std::vector<double> window;
+    std::vector<double> filters;    // dense numBands x numBins
+    std::vector<double> dctBasis;
+
+    void buildFilterbank() {
+        auto hzToMel = [](double hz) { return 2595.0 * std::log10(1.0 + hz / 700.0); };
+        auto melToHz = [](double mel) { return 700.0 * (std::pow(10.0, mel / 2595.0) - 1.0); };
+        // MelFilterbank's bin mapping: Hz * (fftSize/2 + 1) / Nyquist, floored
+        auto hzToBin = [&](double hz) {
+            int bin = static_cast<int>(std::floor(hz * numBins / (config.sampleRate / 2.0)));
+            return std::max(0, std::min(numBins - 1, bin));
+        };
+
+        double melMin = hzToMel(config.fMin);
+        double melStep = (hzToMel(config.fMax) - melMin) / (config.numBands + 1);
+        filters.assign(static_cast<size_t>(config.numBands) * numBins, 0.0);
+        for (int b = 0; b < config.numBands; b++) {
+            int left = hzToBin(melToHz(melMin + b * melStep));
+            int center = hzToBin(melToHz(melMin + (b + 1) * melStep));
+            int right = hzToBin(melToHz(melMin + (b + 2) * melStep));
+            double* row = filters.data() + static_cast<size_t>(b) * numBins;
+            for (int j = left; j <= center && center > left; j++) row[j] = double(j - left) / (center - left);
+            for (int j = center; j <= right && right > center; j++) row[j] = double(right - j) / (right - center);
+        }
+    }
+
+    // Iterative radix-2, in place
+    static void fft(std::vector<std::complex<double>>& data) {
+        int n = static_cast<int>(data.size());
+        for (int i = 1, j = 0; i < n; i++) {
+            int bit = n >> 1;
+            for (; j & bit; bit >>= 1) j ^= bit;
+            j ^= bit;
+            if (i < j) std::swap(data[i], data[j]);
+        }
+        for (int len = 2; len <= n; len <<= 1) {
+            for (int i = 0; i < n; i += len) {
+                for (int k = 0; k < len / 2; k++) {
+                    std::complex<double> w = std::polar(1.0, -2.0 * M_PI * k / len);
+                    std::complex<double> u = data[i + k];
+                    std::complex<double> v = data[i + k + len / 2] * w;
+                    data[i + k] = u + v;
+                    data[i + k + len / 2] = u - v;
+                }
+            }
+        }
+    }
+};
+
+// Statics followed by their regression deltas, per order
+//   d(t) = sum_{n=1..N} n * (x(t+n) - x(t-n)) / (2 * sum_{n=1..N} n²)
+// over the previous order, with frame indices clamped to the sequence (the
+// first/last frame repeats past the edges)
+std::vector<double> referenceDeltas(const std::vector<double>& statics, int numFrames, const ProcessorConfig& config) {
+    int numCoeffs = config.numCoeffs;
+    int width = outputWidth(config);
+    int window = config.deltaWindow;
+    double sumSquares = 0.0;
+    for (int n = 1; n <= window; n++) sumSquares += n * n;
+
+    std::vector<double> rows(static_cast<size_t>(numFrames) * width);
+    for (int f = 0; f < numFrames; f++) {
+        std::copy(statics.begin() + static_cast<size_t>(f) * numCoeffs,
+                  statics.begin() + static_cast<size_t>(f + 1) * numCoeffs,
+                  rows.begin() + static_cast<size_t>(f) * width);
+    }
+    auto at = [&](int frame, int column) {
+        return rows[static_cast<size_t>(std::max(0, std::min(frame, numFrames - 1))) * width + column];
+    };
+    for (int o = 1; o <= config.deltaOrder; o++) {
+        for (int f = 0; f < numFrames; f++) {
+            for (int k = 0; k < numCoeffs; k++) {
+                double sum = 0.0;
+                for (int n = 1; n <= window; n++) {
+                    sum += n * (at(f + n, (o - 1) * numCoeffs + k) - at(f - n, (o - 1) * numCoeffs + k));
+                }
+                rows[static_cast<size_t>(f) * width + o * numCoeffs + k] = sum / (2.0 * sumSquares);
+            }
+        }
+    }
+    return rows;
+}
+
+// Streamed rows: row r is frame r - deltaOrder * N. The stream treats the
+// frames before the first as copies of it, so the deltas of those frames come
+// from the repeated statics (unlike a batch, which repeats the first delta).
+// Padding the statics far enough that no clamp reaches the real frames gives
+// exactly that.
+std::vector<double> referenceStreamed(const std::vector<double>& statics, int numFrames, const ProcessorConfig& config) {
+    int numCoeffs = config.numCoeffs;
+    int delay = config.deltaOrder * config.deltaWindow;
+    int pad = delay + config.deltaWindow;
+    std::vector<double> padded(static_cast<size_t>(pad + numFrames) * numCoeffs);
+    for (int f = 0; f < pad + numFrames; f++) {
+        const double* frame = statics.data() + static_cast<size_t>(std::max(0, f - pad)) * numCoeffs;
+        std::copy(frame, frame + numCoeffs, padded.begin() + static_cast<size_t>(f) * numCoeffs);
+    }
+    std::vector<double> rows = referenceDeltas(padded, pad + numFrames, config);
+    size_t width = outputWidth(config);
+    auto first = rows.begin() + (pad - delay) * width;
+    return std::vector<double>(first, first + numFrames * width);
+}
+
+// Normalizer at its defaults (display range 0-100, decay 0.01, 3 standard
+// deviations for Cmvn) over a statics sequence. Writes the display values and
+// the scale each one was mapped with.
+void referenceDisplay(const std::vector<double>& statics, int numFrames, int numCoeffs, NormalizationMode mode,
+                      std::vector<double>& display, std::vector<double>& scales) {
+    const double minValue = 0.0, maxValue = 100.0, decay = 0.01, zRange = 3.0, epsilon = 1e-6;
+    std::vector<double> mean(numCoeffs), variance(numCoeffs), low(numCoeffs), high(numCoeffs);
+    display.resize(statics.size());
+    scales.resize(statics.size());
+    for (int f = 0; f < numFrames; f++) {
+        for (int k = 0; k < numCoeffs; k++) {
+            size_t i = static_cast<size_t>(f) * numCoeffs + k;
+            double x = statics[i];
+            double scale = 1.0, offset = 0.0;
+            if (mode == NormalizationMode::Cmvn) {
+                if (f == 0) {
+                    mean[k] = x;
+                    variance[k] = 1.0;
+                } else {
+                    double d = x - mean[k];
+                    mean[k] += decay * d;
+                    variance[k] = (1.0 - decay) * (variance[k] + decay * d * d);
+                }
+                scale = 0.5 * (maxValue - minValue) / (zRange * std::sqrt(variance[k] + epsilon));
+                offset = 0.5 * (minValue + maxValue) - mean[k] * scale;
+            } else {
+                if (f == 0) {
+                    low[k] = high[k] = x;
+                } else {
+                    low[k] = x < low[k] ? x : low[k] + decay * (x - low[k]);
+                    high[k] = x > high[k] ? x : high[k] + decay * (x - high[k]);
+                }
+                scale = (maxValue - minValue) / std::max(high[k] - low[k], epsilon);
+                offset = minValue - low[k] * scale;
+            }
+            display[i] = std::max(minValue, std::min(x * scale + offset, maxValue));
+            scales[i] = scale;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Corpus
+
+struct Signal {
+    const char* name;
+    std::vector<float> samples;
+};
+
+// Deterministic uniform noise in [-1, 1)
+struct NoiseSource {
+    uint32_t state;
+    float next() {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<float>(state >> 8) / static_cast<float>(1 << 23) - 1.0f;
+    }
+};
+
+std::vector<Signal> makeCorpus(size_t length, float sampleRate) {
+    const float twoPi = 2.0f * static_cast<float>(M_PI);
+    std::vector<Signal> corpus;
+    NoiseSource noise{12345u};
+
+    Signal tones{"tones", std::vector<float>(length)};
+    for (size_t i = 0; i < length; i++) {
+        float t = static_cast<float>(i) / sampleRate;
+        tones.samples[i] = 0.5f * std::sin(twoPi * 440.0f * t) + 0.25f * std::sin(twoPi * 3150.0f * t) +
+                           0.01f * noise.next();
+    }
+    corpus.push_back(tones);
+
+    // Exponential sweep from 50 Hz to 0.45 * sampleRate
+    Signal chirp{"chirp", std::vector<float>(length)};
+    double f0 = 50.0, f1 = 0.45 * sampleRate, duration = static_cast<double>(length) / sampleRate;
+    double k = std::log(f1 / f0) / duration;
+    for (size_t i = 0; i < length; i++) {
+        double t = static_cast<double>(i) / sampleRate;
+        chirp.samples[i] = static_cast<float>(0.5 * std::sin(2.0 * M_PI * f0 * (std::exp(k * t) - 1.0) / k)) +
+                           0.001f * noise.next();
+    }
+    corpus.push_back(chirp);
+
+    Signal white{"noise", std::vector<float>(length)};
+    for (float& s : white.samples) s = 0.5f * noise.next();
+    corpus.push_back(white);
+
+    Signal quiet{"quiet", std::vector<float>(length)};
+    for (float& s : quiet.samples) s = 1e-4f * noise.next();
+    corpus.push_back(quiet);
+
+    // Clipped square wave with an impulse every 10 ms
+    Signal clicks{"clicks", std::vector<float>(length)};
+    size_t clickPeriod = static_cast<size_t>(sampleRate / 100.0f);
+    for (size_t i = 0; i < length; i++) {
+        float square = std::sin(twoPi * 220.0f * static_cast<float>(i) / sampleRate) >= 0.0f ? 0.3f : -0.3f;
+        clicks.samples[i] = (i % clickPeriod == 0 ? 0.9f : square) + 0.001f * noise.next();
+    }
+    corpus.push_back(clicks);
+
+    corpus.push_back({"silence", std::vector<float>(length, 0.0f)});
+    return corpus;
+}
+
+// ---------------------------------------------------------------------------
+// Backends
+
+struct Shape {
+    const char* name;
+    ProcessorConfig config;
+    // Adds the display history backends (Cmvn and MinMax)
+    bool normalized = false;
+};
+
+ProcessorConfig makeConfig(float sampleRate, int frameLength, int fftSize, int numBands, int numCoeffs,
+                           WindowType windowType) {
+    ProcessorConfig config;
+    config.sampleRate = sampleRate;
+    config.frameLength = frameLength;
+    config.fftSize = fftSize;
+    config.hopLength = frameLength / 2;
+    config.numBands = numBands;
+    config.numCoeffs = numCoeffs;
+    config.windowType = windowType;
+    return sanitizeConfig(config);
+}
+
+// Streamed frames every hop samples through the sliding DFT, which
+// sanitizeConfig only keeps for hops up to slidingDftMaxHop()
+ProcessorConfig withSlidingDft(ProcessorConfig config, int hop) {
+    config.hopLength = hop;
+    config.spectrumEngine = SpectrumEngine::SlidingDft;
+    return sanitizeConfig(config);
+}
+
+ProcessorConfig withDeltas(ProcessorConfig config, int order) {
+    config.deltaOrder = order;
+    return sanitizeConfig(config);
+}
+
+// The default shape at both common AudioContext rates (baked tables), 16 kHz
+// speech and 2048-point music shapes, a zero-padded Kaldi-style frame, a
+// small shape, one with as many coefficients as bands, which DctPlan runs
+// through its FFT path (the reference keeps the mat-vec basis), speech with
+// deltas and delta-deltas, one run through the normalized display history,
+// and two short-hop shapes for the sliding DFT: zero-padded Hamming (one
+// cosine term) and Blackman (two)
+std::vector<Shape> makeShapes() {
+    return {
+        {"default-44100", makeConfig(44100.0f, 1024, 1024, 40, 13, WindowType::Hamming)},
+        {"default-48000", makeConfig(48000.0f, 1024, 1024, 40, 13, WindowType::Hamming)},
+        {"speech-16000", makeConfig(16000.0f, 512, 512, 26, 13, WindowType::Hamming)},
+        {"music-44100", makeConfig(44100.0f, 2048, 2048, 40, 13, WindowType::Hann)},
+        {"kaldi-16000", makeConfig(16000.0f, 400, 512, 40, 13, WindowType::Povey)},
+        {"small-8000", makeConfig(8000.0f, 256, 256, 20, 12, WindowType::Blackman)},
+        {"fftDct-16000", makeConfig(16000.0f, 512, 512, 32, 32, WindowType::Hann)},
+        {"deltas-16000", withDeltas(makeConfig(16000.0f, 512, 512, 26, 13, WindowType::Hamming), 2)},
+        {"normalized-22050", makeConfig(22050.0f, 1024, 1024, 40, 13, WindowType::Hann), true},
+        {"slidingDft-16000", withSlidingDft(makeConfig(16000.0f, 400, 512, 26, 13, WindowType::Hamming), 2)},
+        {"slidingDftBlackman-8000", withSlidingDft(makeConfig(8000.0f, 256, 256, 20, 12, WindowType::Blackman), 1)},
+    };
+}
+
+struct BackendResult {
+    std::string name;
+    double maxAbsError = 0.0;
+    double rmsError = 0.0;
+    std::string worstSignal;
+    int worstFrame = 0;
+    int worstCoeff = 0;
+    double nsPerFrame = 0.0;
+    uint64_t checksum = 14695981039346656037ull;   // FNV-1a over the coefficient bits
+    bool passed() const { return maxAbsError <= kTolerance; }
+};
+
+// Runs one backend over a signal: writes kNumFrames rows of its output
+using RunFn = std::function<void(const Signal& signal, float* output)>;
+
+// What a backend's rows are checked against
+enum class Expect {
+    Batch,     // statics with deltas aligned to their frame
+    Stream,    // the same, delayed by the delta stage
+    Display,   // statics mapped by the normalizer, numCoeffs per row
+};
+
+struct Backend {
+    std::string name;
+    RunFn run;
+    // Produces the same frames without the verification bookkeeping, for timing
+    RunFn time;
+    Expect expect = Expect::Batch;
+    NormalizationMode mode = NormalizationMode::FixedRange;
+    int channels = 1;
+};
+
+void accumulateChecksum(uint64_t& hash, const float* values, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        uint32_t bits;
+        std::memcpy(&bits, &values[i], sizeof(bits));
+        for (int byte = 0; byte < 4; byte++) {
+            hash ^= (bits >> (8 * byte)) & 0xffu;
+            hash *= 1099511628211ull;
+        }
+    }
+}
+
+// Pushes the first `needed` samples in render-quantum blocks: frame f lands
+// after frameLength + f * hop samples. onPush gets the frame count of each push.
+void pushInQuanta(SignalProcessor& processor, const Signal& signal, size_t needed,
+                  const std::function<void(int)>& onPush) {
+    for (size_t offset = 0; offset < needed; offset += kPushBlock) {
+        int n = static_cast<int>(std::min<size_t>(kPushBlock, needed - offset));
+        onPush(processor.pushSamples(signal.samples.data() + offset, n));
+    }
+}
+
+std::vector<Backend> makeBackends(const Shape& shape) {
+    const ProcessorConfig& config = shape.config;
+    std::vector<Backend> backends;
+    int hop = config.hopLength;
+    int numCoeffs = config.numCoeffs;
+    int width = outputWidth(config);
+    size_t needed = static_cast<size_t>(kNumFrames - 1) * hop + config.frameLength;
+
+    auto batchBackend = [&](const char* name, bool realFft, bool specialized, int threads) {
+        auto processor = std::make_shared<SignalProcessor>(config);
+        processor->setUseRealFft(realFft);
+        processor->setUseSpecialized(specialized);
+        processor->setNumThreads(threads);
+        RunFn run = [processor, hop](const Signal& signal, float* output) {
+            processor->processBatch(signal.samples.data(), kNumFrames, hop, output);
+        };
+        backends.push_back({name, run, run});
+    };
+
+    batchBackend("complexFft", false, false, 1);
+    batchBackend("realFft", true, false, 1);
+    if (SignalProcessor(config).getUseSpecialized()) {
+        batchBackend("specialized", true, true, 1);
+    }
+#ifdef SIGNAL_PROCESSOR_THREADS
+    batchBackend("threaded", true, true, 4);
+#endif
+
+    auto streamBackend = [&](const char* name, SpectrumEngine engine) {
+        ProcessorConfig streamConfig = config;
+        streamConfig.spectrumEngine = engine;
+        auto processor = std::make_shared<SignalProcessor>(streamConfig);
+        RunFn run = [processor, needed, width](const Signal& signal, float* output) {
+            processor->resetStream();
+            int framesOut = 0;
+            pushInQuanta(*processor, signal, needed, [&](int frames) {
+                const float* streamed = reinterpret_cast<const float*>(processor->getStreamOutputPtr());
+                for (int f = 0; f < frames && framesOut < kNumFrames; f++, framesOut++) {
+                    std::copy(streamed + f * width, streamed + (f + 1) * width,
+                              output + static_cast<size_t>(framesOut) * width);
+                }
+            });
+        };
+        backends.push_back({name, run, run, Expect::Stream});
+    };
+
+    streamBackend("stream", SpectrumEngine::Fft);
+    if (config.spectrumEngine == SpectrumEngine::SlidingDft) {
+        streamBackend("slidingDft", SpectrumEngine::SlidingDft);
+    }
+
+    // Streamed statics through the display history, one row per frame in
+    // texture order (C0 last)
+    auto historyBackend = [&](const char* name, NormalizationMode mode) {
+        auto processor = std::make_shared<SignalProcessor>(config);
+        processor->setHistoryLength(kNumFrames);
+        processor->setNormalizationMode(mode);
+        RunFn run = [processor, needed, numCoeffs](const Signal& signal, float* output) {
+            processor->resetStream();
+            processor->clearHistory();
+            pushInQuanta(*processor, signal, needed, [](int) {});
+            const float* rows = reinterpret_cast<const float*>(processor->getHistoryPtr());
+            for (int f = 0; f < kNumFrames; f++) {
+                const float* row = rows + static_cast<size_t>(f) * numCoeffs;
+                for (int k = 0; k < numCoeffs; k++) {
+                    output[static_cast<size_t>(f) * numCoeffs + k] = row[numCoeffs - 1 - k];
+                }
+            }
+        };
+        backends.push_back({name, run, run, Expect::Display, mode});
+    };
+
+    if (shape.normalized) {
+        historyBackend("historyCmvn", NormalizationMode::Cmvn);
+        historyBackend("historyMinMax", NormalizationMode::MinMax);
+    }
+
+    // Two channels: the signal and the same signal at -20 dB, checked on both
+    // channels. The timing covers both, reported per channel frame.
+    {
+        auto processor = std::make_shared<MultiChannelProcessor>(config, 2);
+        auto planar = std::make_shared<std::vector<float>>(2 * needed);
+        auto rows = std::make_shared<std::vector<float>>(static_cast<size_t>(kNumFrames) * 2 * width);
+        auto fill = [planar, needed](const Signal& signal) {
+            std::copy(signal.samples.begin(), signal.samples.begin() + needed, planar->begin());
+            for (size_t i = 0; i < needed; i++) (*planar)[needed + i] = 0.1f * signal.samples[i];
+        };
+        RunFn run = [processor, planar, rows, fill, needed, hop, width](const Signal& signal, float* output) {
+            fill(signal);
+            processor->processBatchPlanar(planar->data(), static_cast<int>(needed), kNumFrames, hop, rows->data());
+            // Channel 0 rows first, then channel 1
+            for (int c = 0; c < 2; c++) {
+                for (int f = 0; f < kNumFrames; f++) {
+                    const float* row = rows->data() + (static_cast<size_t>(f) * 2 + c) * width;
+                    std::copy(row, row + width, output + (static_cast<size_t>(c) * kNumFrames + f) * width);
+                }
+            }
+        };
+        RunFn time = [processor, planar, rows, needed, hop](const Signal&, float*) {
+            processor->processBatchPlanar(planar->data(), static_cast<int>(needed), kNumFrames, hop, rows->data());
+        };
+        backends.push_back({"multiChannel", run, time, Expect::Batch, NormalizationMode::FixedRange, 2});
+    }
+    return backends;
+}
+
+// ---------------------------------------------------------------------------
+
+struct ShapeResult {
+    const char* name;
+    ProcessorConfig config;
+    std::vector<BackendResult> backends;
+};
+
+ShapeResult runShape(const Shape& shape, bool timing, double minSeconds) {
+    const ProcessorConfig& config = shape.config;
+    int numCoeffs = config.numCoeffs;
+    size_t length = static_cast<size_t>(kNumFrames - 1) * config.hopLength + config.frameLength;
+    std::vector<Signal> corpus = makeCorpus(length, config.sampleRate);
+
+    // Reference statics per signal and channel gain
+    ReferenceMfcc ref(config);
+    auto referenceStatics = [&](const Signal& signal, float gain) {
+        std::vector<double> coeffs(static_cast<size_t>(kNumFrames) * numCoeffs);
+        std::vector<float> frame(config.frameLength);
+        for (int f = 0; f < kNumFrames; f++) {
+            const float* start = signal.samples.data() + static_cast<size_t>(f) * config.hopLength;
+            for (int i = 0; i < config.frameLength; i++) frame[i] = gain * start[i];
+            ref.compute(frame.data(), coeffs.data() + static_cast<size_t>(f) * numCoeffs);
+        }
+        return coeffs;
+    };
+    std::vector<std::vector<double>> statics[2];
+    for (const Signal& signal : corpus) {
+        statics[0].push_back(referenceStatics(signal, 1.0f));
+        statics[1].push_back(referenceStatics(signal, 0.1f));
+    }
+
+    ShapeResult result{shape.name, config, {}};
+    for (Backend& backend : makeBackends(shape)) {
+        int width = backend.expect == Expect::Display ? numCoeffs : outputWidth(config);
+        BackendResult r;
+        r.name = backend.name;
+        double squaredSum = 0.0;
+        size_t count = 0;
+        std::vector<float> output(static_cast<size_t>(backend.channels) * kNumFrames * width);
+
+        for (size_t s = 0; s < corpus.size(); s++) {
+            const Signal& signal = corpus[s];
+            std::fill(output.begin(), output.end(), 0.0f);
+            backend.run(signal, output.data());
+            accumulateChecksum(r.checksum, output.data(), output.size());
+            for (int c = 0; c < backend.channels; c++) {
+                // Display errors are divided by their scale, back to coefficient units
+                std::vector<double> expected, scales;
+                switch (backend.expect) {
+                    case Expect::Batch: expected = referenceDeltas(statics[c][s], kNumFrames, config); break;
+                    case Expect::Stream: expected = referenceStreamed(statics[c][s], kNumFrames, config); break;
+                    case Expect::Display:
+                        referenceDisplay(statics[c][s], kNumFrames, numCoeffs, backend.mode, expected, scales);
+                        break;
+                }
+                const float* actual = output.data() + static_cast<size_t>(c) * kNumFrames * width;
+                for (size_t i = 0; i < expected.size(); i++) {
+                    double error = std::fabs(actual[i] - expected[i]);
+                    if (!scales.empty()) error /= scales[i];
+                    squaredSum += error * error;
+                    count++;
+                    if (error > r.maxAbsError || std::isnan(error)) {
+                        r.maxAbsError = std::isnan(error) ? INFINITY : error;
+                        r.worstSignal = signal.name;
+                        r.worstFrame = static_cast<int>(i) / width;
+                        r.worstCoeff = static_cast<int>(i) % width;
+                    }
+                }
+            }
+        }
+        r.rmsError = std::sqrt(squaredSum / count);
+
+        if (timing) {
+            const Signal& signal = corpus.front();
+            double nsPerCall = timeNsPerCall([&]() {
+                backend.time(signal, output.data());
+                sink = output[0];
+            }, minSeconds);
+            r.nsPerFrame = nsPerCall / (kNumFrames * backend.channels);
+        }
+        result.backends.push_back(r);
+    }
+    return result;
+}
+
+void writeJson(FILE* out, const std::vector<ShapeResult>& results, bool timing, double minSeconds, bool passed) {
+    std::fprintf(out, "{\n");
+    std::fprintf(out, "  \"platform\": \"%s\",\n",
+#ifdef __EMSCRIPTEN__
+                 "wasm"
+#else
+                 "native"
+#endif
+    );
+    std::fprintf(out, "  \"simd\": %s,\n", kernels::kSimdEnabled ? "true" : "false");
+    std::fprintf(out, "  \"precision\": \"%s\",\n", kPrecision == Precision::Fast ? "fast" : "exact");
+    std::fprintf(out, "  \"framesPerSignal\": %d,\n", kNumFrames);
+    std::fprintf(out, "  \"tolerance\": %.1e,\n", kTolerance);
+    if (timing) std::fprintf(out, "  \"minTimeMs\": %.1f,\n", minSeconds * 1e3);
+    std::fprintf(out, "  \"passed\": %s,\n", passed ? "true" : "false");
+    std::fprintf(out, "  \"shapes\": [\n");
+    for (size_t s = 0; s < results.size(); s++) {
+        const ShapeResult& shape = results[s];
+        const ProcessorConfig& c = shape.config;
+        std::fprintf(out,
+            "    {\"name\": \"%s\", \"sampleRate\": %.0f, \"frameLength\": %d, \"fftSize\": %d, "
+            "\"hopLength\": %d, \"numBands\": %d, \"numCoeffs\": %d, \"deltaOrder\": %d, \"dct\": \"%s\",\n"
+            "     \"backends\": [\n",
+            shape.name, c.sampleRate, c.frameLength, c.fftSize, c.hopLength, c.numBands, c.numCoeffs, c.deltaOrder,
+            DctPlan::useFftPath(c.numBands, c.numCoeffs) ? "fft" : "matVec");
+        for (size_t b = 0; b < shape.backends.size(); b++) {
+            const BackendResult& r = shape.backends[b];
+            std::fprintf(out,
+                "      {\"name\": \"%s\", \"passed\": %s, \"maxAbsError\": %.3e, \"rmsError\": %.3e, "
+                "\"worst\": {\"signal\": \"%s\", \"frame\": %d, \"coeff\": %d},\n       "
+                "\"checksum\": \"%016llx\"",
+                r.name.c_str(), r.passed() ? "true" : "false", r.maxAbsError, r.rmsError,
+                r.worstSignal.c_str(), r.worstFrame, r.worstCoeff, static_cast<unsigned long long>(r.checksum));
+            if (timing) {
+                std::fprintf(out, ", \"nsPerFrame\": %.1f, \"framesPerSec\": %.1f", r.nsPerFrame, 1e9 / r.nsPerFrame);
+            }
+            std::fprintf(out, "}%s\n", b + 1 < shape.backends.size() ? "," : "");
+        }
+        std::fprintf(out, "     ]}%s\n", s + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(out, "  ]\n}\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    double minSeconds = 0.02;
+    bool timing = true;
+    const char* outputPath = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--no-timing") {
+            timing = false;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            std::fprintf(stderr, "Usage: mfcc_golden [--min-time-ms MS] [--no-timing] [--output FILE]\n");
+            return 1;
+        }
+        const char* value = argv[++i];
+        if (arg == "--min-time-ms") minSeconds = std::atof(value) / 1e3;
+        else if (arg == "--output") outputPath = value;
+        else {
+            std::fprintf(stderr, "Unknown option: %s\n", arg.c_str());
+            return 1;
+        }
+    }
+
+    std::vector<ShapeResult> results;
+    bool passed = true;
+    for (const Shape& shape : makeShapes()) {
+        results.push_back(runShape(shape, timing, minSeconds));
+        for (const BackendResult& r : results.back().backends) {
+            if (!r.passed()) {
+                std::fprintf(stderr, "%s/%s: max error %.3e at %s frame %d coeff %d exceeds %.1e\n",
+                             shape.name, r.name.c_str(), r.maxAbsError, r.worstSignal.c_str(), r.worstFrame,
+                             r.worstCoeff, kTolerance);
+                passed = false;
+            }
+        }
+    }
+
+    FILE* out = outputPath ? std::fopen(outputPath, "w") : stdout;
+    if (!out) {
+        std::fprintf(stderr, "Cannot write %s\n", outputPath);
+        return 1;
+    }
+    writeJson(out, results, timing, minSeconds, passed);
+    if (outputPath) std::fclose(out);
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <vector>
+#include <complex>
+#include <cmath>
+#include <memory>
+
+#include "fft_plan.h"
+#include "simd_kernels.h"
+#include "baked_tables.h"
+
+// Orthonormal DCT-II truncated to the first numCoeffs outputs.
+// The basis (with the 1/sqrt(N) and sqrt(2/N) scaling folded in) is computed
+// once as a contiguous row-major numCoeffs x numInputs matrix, so a transform
+// is one small mat-vec. When many coefficients are requested from a
+// power-of-2 input the N-point FFT route (Makhoul) is used instead.
+class DctPlan {
+public:
+    DctPlan(int numInputs, int numCoeffs)
+        : numInputs(numInputs), numCoeffs(numCoeffs) {
+        // Normalization factor
+        double normFactor0 = 1.0 / std::sqrt(static_cast<double>(numInputs));
+        double normFactor = std::sqrt(2.0 / numInputs);
+
+        if (useFftPath(numInputs, numCoeffs)) {
+            fftPlan.reset(new FftPlan(numInputs));
+            // X[k] = norm_k * Re(V[k] * e^(-iπk/2N))
+            postTwiddles.resize(numCoeffs);
+            for (int k = 0; k < numCoeffs; k++) {
+                double angle = -M_PI * k / (2.0 * numInputs);
+                double scale = k == 0 ? normFactor0 : normFactor;
+                postTwiddles[k] = std::complex<float>(static_cast<float>(scale * std::cos(angle)),
+                                                      static_cast<float>(scale * std::sin(angle)));
+            }
+            return;
+        }
+
+        if (const float* baked = baked_tables::dctBasis(numInputs, numCoeffs)) {
+            basis.assign(baked, baked + static_cast<size_t>(numCoeffs) * numInputs);
+            return;
+        }
+        basis.resize(static_cast<size_t>(numCoeffs) * numInputs);
+        for (int k = 0; k < numCoeffs; k++) {
+            double scale = k == 0 ? normFactor0 : normFactor;
+            for (int n = 0; n < numInputs; n++) {
+                basis[k * numInputs + n] =
+                    static_cast<float>(scale * std::cos(M_PI * k * (2*n + 1) / (2.0 * numInputs)));
+            }
+        }
+    }
+
+    int getNumInputs() const { return numInputs; }
+    int getNumCoeffs() const { return numCoeffs; }
+    bool usesFft() const { return fftPlan != nullptr; }
+    // Row-major numCoeffs x numInputs basis (empty on the FFT path)
+    const std::vector<float>& getBasis() const { return basis; }
+    // Complex work area apply() needs, 0 for the mat-vec path
+    int getScratchSize() const { return fftPlan ? numInputs : 0; }
+
+    // Reads numInputs values, writes numCoeffs coefficients. scratch must hold
+    // getScratchSize() values; the plan itself is read-only and can be shared.
+    void apply(const float* input, float* coeffs, std::complex<float>* scratch) const {
+        if (fftPlan) {
+            applyFft(input, coeffs, scratch);
+            return;
+        }
+        for (int k = 0; k < numCoeffs; k++) {
+            coeffs[k] = kernels::dot(input, basis.data() + k * numInputs, numInputs);
+        }
+    }
+
+    // The mat-vec costs numCoeffs*N multiply-adds against roughly 5*N*log2(N)
+    // flops for the FFT, so only switch when the coefficient count is large
+    static constexpr bool useFftPath(int numInputs, int numCoeffs) {
+        if (numInputs < 2 || (numInputs & (numInputs - 1)) != 0) return false;
+        int log2n = 0;
+        while ((1 << log2n) < numInputs) log2n++;
+        return numCoeffs > 4 * log2n;
+    }
+
+private:
+    int numInputs;
+    int numCoeffs;
+    std::vector<float> basis;
+    std::unique_ptr<FftPlan> fftPlan;
+    std::vector<std::complex<float>> postTwiddles;
+
+    void applyFft(const float* input, float* coeffs, std::complex<float>* scratch) const {
+        int n = numInputs;
+        // Even samples ascending, odd samples descending
+        for (int i = 0; i < n / 2; i++) {
+            scratch[i] = std::complex<float>(input[2 * i], 0.0f);
+            scratch[n - 1 - i] = std::complex<float>(input[2 * i + 1], 0.0f);
+        }
+        fftPlan->execute(scratch);
+        for (int k = 0; k < numCoeffs; k++) {
+            const std::complex<float>& v = scratch[k];
+            const std::complex<float>& w = postTwiddles[k];
+            coeffs[k] = v.real() * w.real() - v.imag() * w.imag();
+        }
+    }
+};
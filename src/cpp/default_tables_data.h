@@ -0,0 +1,800 @@
+// Generated by native/gen_default_tables.cpp, do not edit.
+// Regenerate with: cmake --build <native build dir> --target regenerate_default_tables
+#pragma once
+
+namespace default_tables {
+
+constexpr int kTwiddleSize = 1024;
+constexpr float kTwiddles[1024] = {
+    1.00000000f, -0.00000000f, 0.999981165f, -0.00613588467f, 0.999924719f, -0.0122715384f,
+    0.999830604f, -0.0184067301f, 0.999698818f, -0.0245412290f, 0.999529421f, -0.0306748040f,
+    0.999322355f, -0.0368072242f, 0.999077737f, -0.0429382585f, 0.998795450f, -0.0490676761f,
+    0.998475552f, -0.0551952459f, 0.998118103f, -0.0613207370f, 0.997723043f, -0.0674439222f,
+    0.997290432f, -0.0735645667f, 0.996820271f, -0.0796824396f, 0.996312618f, -0.0857973099f,
+    0.995767415f, -0.0919089541f, 0.995184720f, -0.0980171412f, 0.994564593f, -0.104121633f,
+    0.993906975f, -0.110222206f, 0.993211925f, -0.116318628f, 0.992479563f, -0.122410677f,
+    0.991709769f, -0.128498107f, 0.990902662f, -0.134580702f, 0.990058184f, -0.140658244f,
+    0.989176512f, -0.146730468f, 0.988257587f, -0.152797192f, 0.987301409f, -0.158858150f,
+    0.986308098f, -0.164913118f, 0.985277653f, -0.170961887f, 0.984210074f, -0.177004218f,
+    0.983105481f, -0.183039889f, 0.981963873f, -0.189068660f, 0.980785251f, -0.195090324f,
+    0.979569793f, -0.201104641f, 0.978317380f, -0.207111374f, 0.977028131f, -0.213110313f,
+    0.975702107f, -0.219101235f, 0.974339366f, -0.225083917f, 0.972939968f, -0.231058106f,
+    0.971503913f, -0.237023607f, 0.970031261f, -0.242980182f, 0.968522072f, -0.248927608f,
+    0.966976464f, -0.254865646f, 0.965394437f, -0.260794103f, 0.963776052f, -0.266712755f,
+    0.962121427f, -0.272621363f, 0.960430503f, -0.278519690f, 0.958703458f, -0.284407526f,
+    0.956940353f, -0.290284663f, 0.955141187f, -0.296150893f, 0.953306019f, -0.302005947f,
+    0.951435030f, -0.307849646f, 0.949528158f, -0.313681751f, 0.947585583f, -0.319502026f,
+    0.945607305f, -0.325310290f, 0.943593442f, -0.331106305f, 0.941544056f, -0.336889863f,
+    0.939459205f, -0.342660725f, 0.937339008f, -0.348418683f, 0.935183525f, -0.354163527f,
+    0.932992816f, -0.359895051f, 0.930766940f, -0.365612984f, 0.928506076f, -0.371317208f,
+    0.926210225f, -0.377007425f, 0.923879504f, -0.382683426f, 0.921514034f, -0.388345033f,
+    0.919113874f, -0.393992037f, 0.916679084f, -0.399624199f, 0.914209783f, -0.405241311f,
+    0.911706030f, -0.410843164f, 0.909168005f, -0.416429549f, 0.906595707f, -0.422000259f,
+    0.903989315f, -0.427555084f, 0.901348829f, -0.433093816f, 0.898674488f, -0.438616246f,
+    0.895966232f, -0.444122136f, 0.893224299f, -0.449611336f, 0.890448749f, -0.455083579f,
+    0.887639642f, -0.460538715f, 0.884797096f, -0.465976506f, 0.881921291f, -0.471396744f,
+    0.879012227f, -0.476799220f, 0.876070082f, -0.482183784f, 0.873094976f, -0.487550169f,
+    0.870086968f, -0.492898196f, 0.867046237f, -0.498227656f, 0.863972843f, -0.503538370f,
+    0.860866964f, -0.508830130f, 0.857728601f, -0.514102757f, 0.854557991f, -0.519356012f,
+    0.851355195f, -0.524589658f, 0.848120332f, -0.529803634f, 0.844853580f, -0.534997642f,
+    0.841554999f, -0.540171444f, 0.838224709f, -0.545324981f, 0.834862888f, -0.550457954f,
+    0.831469595f, -0.555570245f, 0.828045070f, -0.560661554f, 0.824589312f, -0.565731823f,
+    0.821102500f, -0.570780754f, 0.817584813f, -0.575808167f, 0.814036310f, -0.580813944f,
+    0.810457170f, -0.585797846f, 0.806847572f, -0.590759695f, 0.803207517f, -0.595699310f,
+    0.799537241f, -0.600616455f, 0.795836926f, -0.605511069f, 0.792106569f, -0.610382795f,
+    0.788346410f, -0.615231574f, 0.784556568f, -0.620057225f, 0.780737221f, -0.624859512f,
+    0.776888490f, -0.629638255f, 0.773010433f, -0.634393275f, 0.769103348f, -0.639124453f,
+    0.765167236f, -0.643831551f, 0.761202395f, -0.648514390f, 0.757208824f, -0.653172851f,
+    0.753186822f, -0.657806695f, 0.749136388f, -0.662415802f, 0.745057762f, -0.666999936f,
+    0.740951121f, -0.671558976f, 0.736816585f, -0.676092684f, 0.732654274f, -0.680601001f,
+    0.728464365f, -0.685083687f, 0.724247098f, -0.689540565f, 0.720002532f, -0.693971455f,
+    0.715730846f, -0.698376238f, 0.711432219f, -0.702754736f, 0.707106769f, -0.707106769f,
+    0.702754736f, -0.711432219f, 0.698376238f, -0.715730846f, 0.693971455f, -0.720002532f,
+    0.689540565f, -0.724247098f, 0.685083687f, -0.728464365f, 0.680601001f, -0.732654274f,
+    0.676092684f, -0.736816585f, 0.671558976f, -0.740951121f, 0.666999936f, -0.745057762f,
+    0.662415802f, -0.749136388f, 0.657806695f, -0.753186822f, 0.653172851f, -0.757208824f,
+    0.648514390f, -0.761202395f, 0.643831551f, -0.765167236f, 0.639124453f, -0.769103348f,
+    0.634393275f, -0.773010433f, 0.629638255f, -0.776888490f, 0.624859512f, -0.780737221f,
+    0.620057225f, -0.784556568f, 0.615231574f, -0.788346410f, 0.610382795f, -0.792106569f,
+    0.605511069f, -0.795836926f, 0.600616455f, -0.799537241f, 0.595699310f, -0.803207517f,
+    0.590759695f, -0.806847572f, 0.585797846f, -0.810457170f, 0.580813944f, -0.814036310f,
+    0.575808167f, -0.817584813f, 0.570780754f, -0.821102500f, 0.565731823f, -0.824589312f,
+    0.560661554f, -0.828045070f, 0.555570245f, -0.831469595f, 0.550457954f, -0.834862888f,
+    0.545324981f, -0.838224709f, 0.540171444f, -0.841554999f, 0.534997642f, -0.844853580f,
+    0.529803634f, -0.848120332f, 0.524589658f, -0.851355195f, 0.519356012f, -0.854557991f,
+    0.514102757f, -0.857728601f, 0.508830130f, -0.860866964f, 0.503538370f, -0.863972843f,
+    0.498227656f, -0.867046237f, 0.492898196f, -0.870086968f, 0.487550169f, -0.873094976f,
+    0.482183784f, -0.876070082f, 0.476799220f, -0.879012227f, 0.471396744f, -0.881921291f,
+    0.465976506f, -0.884797096f, 0.460538715f, -0.887639642f, 0.455083579f, -0.890448749f,
+    0.449611336f, -0.893224299f, 0.444122136f, -0.895966232f, 0.438616246f, -0.898674488f,
+    0.433093816f, -0.901348829f, 0.427555084f, -0.903989315f, 0.422000259f, -0.906595707f,
+    0.416429549f, -0.909168005f, 0.410843164f, -0.911706030f, 0.405241311f, -0.914209783f,
+    0.399624199f, -0.916679084f, 0.393992037f, -0.919113874f, 0.388345033f, -0.921514034f,
+    0.382683426f, -0.923879504f, 0.377007425f, -0.926210225f, 0.371317208f, -0.928506076f,
+    0.365612984f, -0.930766940f, 0.359895051f, -0.932992816f, 0.354163527f, -0.935183525f,
+    0.348418683f, -0.937339008f, 0.342660725f, -0.939459205f, 0.336889863f, -0.941544056f,
+    0.331106305f, -0.943593442f, 0.325310290f, -0.945607305f, 0.319502026f, -0.947585583f,
+    0.313681751f, -0.949528158f, 0.307849646f, -0.951435030f, 0.302005947f, -0.953306019f,
+    0.296150893f, -0.955141187f, 0.290284663f, -0.956940353f, 0.284407526f, -0.958703458f,
+    0.278519690f, -0.960430503f, 0.272621363f, -0.962121427f, 0.266712755f, -0.963776052f,
+    0.260794103f, -0.965394437f, 0.254865646f, -0.966976464f, 0.248927608f, -0.968522072f,
+    0.242980182f, -0.970031261f, 0.237023607f, -0.971503913f, 0.231058106f, -0.972939968f,
+    0.225083917f, -0.974339366f, 0.219101235f, -0.975702107f, 0.213110313f, -0.977028131f,
+    0.207111374f, -0.978317380f, 0.201104641f, -0.979569793f, 0.195090324f, -0.980785251f,
+    0.189068660f, -0.981963873f, 0.183039889f, -0.983105481f, 0.177004218f, -0.984210074f,
+    0.170961887f, -0.985277653f, 0.164913118f, -0.986308098f, 0.158858150f, -0.987301409f,
+    0.152797192f, -0.988257587f, 0.146730468f, -0.989176512f, 0.140658244f, -0.990058184f,
+    0.134580702f, -0.990902662f, 0.128498107f, -0.991709769f, 0.122410677f, -0.992479563f,
+    0.116318628f, -0.993211925f, 0.110222206f, -0.993906975f, 0.104121633f, -0.994564593f,
+    0.0980171412f, -0.995184720f, 0.0919089541f, -0.995767415f, 0.0857973099f, -0.996312618f,
+    0.0796824396f, -0.996820271f, 0.0735645667f, -0.997290432f, 0.0674439222f, -0.997723043f,
+    0.0613207370f, -0.998118103f, 0.0551952459f, -0.998475552f, 0.0490676761f, -0.998795450f,
+    0.0429382585f, -0.999077737f, 0.0368072242f, -0.999322355f, 0.0306748040f, -0.999529421f,
+    0.0245412290f, -0.999698818f, 0.0184067301f, -0.999830604f, 0.0122715384f, -0.999924719f,
+    0.00613588467f, -0.999981165f, 6.12323426e-17f, -1.00000000f, -0.00613588467f, -0.999981165f,
+    -0.0122715384f, -0.999924719f, -0.0184067301f, -0.999830604f, -0.0245412290f, -0.999698818f,
+    -0.0306748040f, -0.999529421f, -0.0368072242f, -0.999322355f, -0.0429382585f, -0.999077737f,
+    -0.0490676761f, -0.998795450f, -0.0551952459f, -0.998475552f, -0.0613207370f, -0.998118103f,
+    -0.0674439222f, -0.997723043f, -0.0735645667f, -0.997290432f, -0.0796824396f, -0.996820271f,
+    -0.0857973099f, -0.996312618f, -0.0919089541f, -0.995767415f, -0.0980171412f, -0.995184720f,
+    -0.104121633f, -0.994564593f, -0.110222206f, -0.993906975f, -0.116318628f, -0.993211925f,
+    -0.122410677f, -0.992479563f, -0.128498107f, -0.991709769f, -0.134580702f, -0.990902662f,
+    -0.140658244f, -0.990058184f, -0.146730468f, -0.989176512f, -0.152797192f, -0.988257587f,
+    -0.158858150f, -0.987301409f, -0.164913118f, -0.986308098f, -0.170961887f, -0.985277653f,
+    -0.177004218f, -0.984210074f, -0.183039889f, -0.983105481f, -0.189068660f, -0.981963873f,
+    -0.195090324f, -0.980785251f, -0.201104641f, -0.979569793f, -0.207111374f, -0.978317380f,
+    -0.213110313f, -0.977028131f, -0.219101235f, -0.975702107f, -0.225083917f, -0.974339366f,
+    -0.231058106f, -0.972939968f, -0.237023607f, -0.971503913f, -0.242980182f, -0.970031261f,
+    -0.248927608f, -0.968522072f, -0.254865646f, -0.966976464f, -0.260794103f, -0.965394437f,
+    -0.266712755f, -0.963776052f, -0.272621363f, -0.962121427f, -0.278519690f, -0.960430503f,
+    -0.284407526f, -0.958703458f, -0.290284663f, -0.956940353f, -0.296150893f, -0.955141187f,
+    -0.302005947f, -0.953306019f, -0.307849646f, -0.951435030f, -0.313681751f, -0.949528158f,
+    -0.319502026f, -0.947585583f, -0.325310290f, -0.945607305f, -0.331106305f, -0.943593442f,
+    -0.336889863f, -0.941544056f, -0.342660725f, -0.939459205f, -0.348418683f, -0.937339008f,
+    -0.354163527f, -0.935183525f, -0.359895051f, -0.932992816f, -0.365612984f, -0.930766940f,
+    -0.371317208f, -0.928506076f, -0.377007425f, -0.926210225f, -0.382683426f, -0.923879504f,
+    -0.388345033f, -0.921514034f, -0.393992037f, -0.919113874f, -0.399624199f, -0.916679084f,
+    -0.405241311f, -0.914209783f, -0.410843164f, -0.911706030f, -0.416429549f, -0.909168005f,
+    -0.422000259f, -0.906595707f, -0.427555084f, -0.903989315f, -0.433093816f, -0.901348829f,
+    -0.438616246f, -0.898674488f, -0.444122136f, -0.895966232f, -0.449611336f, -0.893224299f,
+    -0.455083579f, -0.890448749f, -0.460538715f, -0.887639642f, -0.465976506f, -0.884797096f,
+    -0.471396744f, -0.881921291f, -0.476799220f, -0.879012227f, -0.482183784f, -0.876070082f,
+    -0.487550169f, -0.873094976f, -0.492898196f, -0.870086968f, -0.498227656f, -0.867046237f,
+    -0.503538370f, -0.863972843f, -0.508830130f, -0.860866964f, -0.514102757f, -0.857728601f,
+    -0.519356012f, -0.854557991f, -0.524589658f, -0.851355195f, -0.529803634f, -0.848120332f,
+    -0.534997642f, -0.844853580f, -0.540171444f, -0.841554999f, -0.545324981f, -0.838224709f,
+    -0.550457954f, -0.834862888f, -0.555570245f, -0.831469595f, -0.560661554f, -0.828045070f,
+    -0.565731823f, -0.824589312f, -0.570780754f, -0.821102500f, -0.575808167f, -0.817584813f,
+    -0.580813944f, -0.814036310f, -0.585797846f, -0.810457170f, -0.590759695f, -0.806847572f,
+    -0.595699310f, -0.803207517f, -0.600616455f, -0.799537241f, -0.605511069f, -0.795836926f,
+    -0.610382795f, -0.792106569f, -0.615231574f, -0.788346410f, -0.620057225f, -0.784556568f,
+    -0.624859512f, -0.780737221f, -0.629638255f, -0.776888490f, -0.634393275f, -0.773010433f,
+    -0.639124453f, -0.769103348f, -0.643831551f, -0.765167236f, -0.648514390f, -0.761202395f,
+    -0.653172851f, -0.757208824f, -0.657806695f, -0.753186822f, -0.662415802f, -0.749136388f,
+    -0.666999936f, -0.745057762f, -0.671558976f, -0.740951121f, -0.676092684f, -0.736816585f,
+    -0.680601001f, -0.732654274f, -0.685083687f, -0.728464365f, -0.689540565f, -0.724247098f,
+    -0.693971455f, -0.720002532f, -0.698376238f, -0.715730846f, -0.702754736f, -0.711432219f,
+    -0.707106769f, -0.707106769f, -0.711432219f, -0.702754736f, -0.715730846f, -0.698376238f,
+    -0.720002532f, -0.693971455f, -0.724247098f, -0.689540565f, -0.728464365f, -0.685083687f,
+    -0.732654274f, -0.680601001f, -0.736816585f, -0.676092684f, -0.740951121f, -0.671558976f,
+    -0.745057762f, -0.666999936f, -0.749136388f, -0.662415802f, -0.753186822f, -0.657806695f,
+    -0.757208824f, -0.653172851f, -0.761202395f, -0.648514390f, -0.765167236f, -0.643831551f,
+    -0.769103348f, -0.639124453f, -0.773010433f, -0.634393275f, -0.776888490f, -0.629638255f,
+    -0.780737221f, -0.624859512f, -0.784556568f, -0.620057225f, -0.788346410f, -0.615231574f,
+    -0.792106569f, -0.610382795f, -0.795836926f, -0.605511069f, -0.799537241f, -0.600616455f,
+    -0.803207517f, -0.595699310f, -0.806847572f, -0.590759695f, -0.810457170f, -0.585797846f,
+    -0.814036310f, -0.580813944f, -0.817584813f, -0.575808167f, -0.821102500f, -0.570780754f,
+    -0.824589312f, -0.565731823f, -0.828045070f, -0.560661554f, -0.831469595f, -0.555570245f,
+    -0.834862888f, -0.550457954f, -0.838224709f, -0.545324981f, -0.841554999f, -0.540171444f,
+    -0.844853580f, -0.534997642f, -0.848120332f, -0.529803634f, -0.851355195f, -0.524589658f,
+    -0.854557991f, -0.519356012f, -0.857728601f, -0.514102757f, -0.860866964f, -0.508830130f,
+    -0.863972843f, -0.503538370f, -0.867046237f, -0.498227656f, -0.870086968f, -0.492898196f,
+    -0.873094976f, -0.487550169f, -0.876070082f, -0.482183784f, -0.879012227f, -0.476799220f,
+    -0.881921291f, -0.471396744f, -0.884797096f, -0.465976506f, -0.887639642f, -0.460538715f,
+    -0.890448749f, -0.455083579f, -0.893224299f, -0.449611336f, -0.895966232f, -0.444122136f,
+    -0.898674488f, -0.438616246f, -0.901348829f, -0.433093816f, -0.903989315f, -0.427555084f,
+    -0.906595707f, -0.422000259f, -0.909168005f, -0.416429549f, -0.911706030f, -0.410843164f,
+    -0.914209783f, -0.405241311f, -0.916679084f, -0.399624199f, -0.919113874f, -0.393992037f,
+    -0.921514034f, -0.388345033f, -0.923879504f, -0.382683426f, -0.926210225f, -0.377007425f,
+    -0.928506076f, -0.371317208f, -0.930766940f, -0.365612984f, -0.932992816f, -0.359895051f,
+    -0.935183525f, -0.354163527f, -0.937339008f, -0.348418683f, -0.939459205f, -0.342660725f,
+    -0.941544056f, -0.336889863f, -0.943593442f, -0.331106305f, -0.945607305f, -0.325310290f,
+    -0.947585583f, -0.319502026f, -0.949528158f, -0.313681751f, -0.951435030f, -0.307849646f,
+    -0.953306019f, -0.302005947f, -0.955141187f, -0.296150893f, -0.956940353f, -0.290284663f,
+    -0.958703458f, -0.284407526f, -0.960430503f, -0.278519690f, -0.962121427f, -0.272621363f,
+    -0.963776052f, -0.266712755f, -0.965394437f, -0.260794103f, -0.966976464f, -0.254865646f,
+    -0.968522072f, -0.248927608f, -0.970031261f, -0.242980182f, -0.971503913f, -0.237023607f,
+    -0.972939968f, -0.231058106f, -0.974339366f, -0.225083917f, -0.975702107f, -0.219101235f,
+    -0.977028131f, -0.213110313f, -0.978317380f, -0.207111374f, -0.979569793f, -0.201104641f,
+    -0.980785251f, -0.195090324f, -0.981963873f, -0.189068660f, -0.983105481f, -0.183039889f,
+    -0.984210074f, -0.177004218f, -0.985277653f, -0.170961887f, -0.986308098f, -0.164913118f,
+    -0.987301409f, -0.158858150f, -0.988257587f, -0.152797192f, -0.989176512f, -0.146730468f,
+    -0.990058184f, -0.140658244f, -0.990902662f, -0.134580702f, -0.991709769f, -0.128498107f,
+    -0.992479563f, -0.122410677f, -0.993211925f, -0.116318628f, -0.993906975f, -0.110222206f,
+    -0.994564593f, -0.104121633f, -0.995184720f, -0.0980171412f, -0.995767415f, -0.0919089541f,
+    -0.996312618f, -0.0857973099f, -0.996820271f, -0.0796824396f, -0.997290432f, -0.0735645667f,
+    -0.997723043f, -0.0674439222f, -0.998118103f, -0.0613207370f, -0.998475552f, -0.0551952459f,
+    -0.998795450f, -0.0490676761f, -0.999077737f, -0.0429382585f, -0.999322355f, -0.0368072242f,
+    -0.999529421f, -0.0306748040f, -0.999698818f, -0.0245412290f, -0.999830604f, -0.0184067301f,
+    -0.999924719f, -0.0122715384f, -0.999981165f, -0.00613588467f,
+};
+
+constexpr int kWindowLength = 1024;
+constexpr float kHammingWindow[1024] = {
+    0.0800000131f, 0.0800086930f, 0.0800347179f, 0.0800780952f, 0.0801388249f, 0.0802169070f,
+    0.0803123266f, 0.0804250911f, 0.0805551857f, 0.0807026178f, 0.0808673725f, 0.0810494497f,
+    0.0812488422f, 0.0814655349f, 0.0816995278f, 0.0819508061f, 0.0822193697f, 0.0825051963f,
+    0.0828082860f, 0.0831286162f, 0.0834661871f, 0.0838209763f, 0.0841929764f, 0.0845821649f,
+    0.0849885419f, 0.0854120776f, 0.0858527645f, 0.0863105804f, 0.0867855102f, 0.0872775391f,
+    0.0877866447f, 0.0883128121f, 0.0888560191f, 0.0894162431f, 0.0899934620f, 0.0905876607f,
+    0.0911988094f, 0.0918268859f, 0.0924718753f, 0.0931337401f, 0.0938124657f, 0.0945080221f,
+    0.0952203870f, 0.0959495232f, 0.0966954157f, 0.0974580348f, 0.0982373431f, 0.0990333110f,
+    0.0998459235f, 0.100675136f, 0.101520918f, 0.102383241f, 0.103262074f, 0.104157388f,
+    0.105069138f, 0.105997294f, 0.106941819f, 0.107902683f, 0.108879849f, 0.109873280f,
+    0.110882930f, 0.111908771f, 0.112950765f, 0.114008866f, 0.115083031f, 0.116173230f,
+    0.117279418f, 0.118401557f, 0.119539589f, 0.120693490f, 0.121863209f, 0.123048693f,
+    0.124249913f, 0.125466809f, 0.126699358f, 0.127947479f, 0.129211158f, 0.130490333f,
+    0.131784946f, 0.133094966f, 0.134420335f, 0.135760993f, 0.137116909f, 0.138488024f,
+    0.139874279f, 0.141275644f, 0.142692029f, 0.144123420f, 0.145569727f, 0.147030920f,
+    0.148506939f, 0.149997741f, 0.151503235f, 0.153023392f, 0.154558137f, 0.156107441f,
+    0.157671213f, 0.159249410f, 0.160841972f, 0.162448838f, 0.164069936f, 0.165705219f,
+    0.167354628f, 0.169018090f, 0.170695558f, 0.172386944f, 0.174092203f, 0.175811261f,
+    0.177544057f, 0.179290533f, 0.181050614f, 0.182824224f, 0.184611320f, 0.186411828f,
+    0.188225657f, 0.190052763f, 0.191893086f, 0.193746522f, 0.195613027f, 0.197492510f,
+    0.199384928f, 0.201290190f, 0.203208238f, 0.205138981f, 0.207082361f, 0.209038287f,
+    0.211006716f, 0.212987542f, 0.214980721f, 0.216986150f, 0.219003752f, 0.221033484f,
+    0.223075226f, 0.225128949f, 0.227194533f, 0.229271919f, 0.231361032f, 0.233461782f,
+    0.235574096f, 0.237697899f, 0.239833102f, 0.241979629f, 0.244137391f, 0.246306330f,
+    0.248486340f, 0.250677347f, 0.252879262f, 0.255092025f, 0.257315516f, 0.259549677f,
+    0.261794418f, 0.264049649f, 0.266315311f, 0.268591255f, 0.270877481f, 0.273173839f,
+    0.275480270f, 0.277796656f, 0.280122966f, 0.282459050f, 0.284804881f, 0.287160307f,
+    0.289525300f, 0.291899741f, 0.294283509f, 0.296676576f, 0.299078822f, 0.301490128f,
+    0.303910464f, 0.306339681f, 0.308777720f, 0.311224490f, 0.313679874f, 0.316143811f,
+    0.318616182f, 0.321096897f, 0.323585898f, 0.326083034f, 0.328588277f, 0.331101447f,
+    0.333622545f, 0.336151391f, 0.338687927f, 0.341232091f, 0.343783706f, 0.346342772f,
+    0.348909110f, 0.351482660f, 0.354063332f, 0.356651008f, 0.359245628f, 0.361847043f,
+    0.364455163f, 0.367069930f, 0.369691223f, 0.372318923f, 0.374952942f, 0.377593219f,
+    0.380239606f, 0.382892013f, 0.385550350f, 0.388214529f, 0.390884399f, 0.393559933f,
+    0.396240979f, 0.398927420f, 0.401619226f, 0.404316217f, 0.407018334f, 0.409725487f,
+    0.412437528f, 0.415154397f, 0.417875975f, 0.420602173f, 0.423332840f, 0.426067948f,
+    0.428807318f, 0.431550920f, 0.434298575f, 0.437050253f, 0.439805776f, 0.442565113f,
+    0.445328116f, 0.448094666f, 0.450864702f, 0.453638107f, 0.456414759f, 0.459194571f,
+    0.461977422f, 0.464763224f, 0.467551857f, 0.470343232f, 0.473137230f, 0.475933760f,
+    0.478732705f, 0.481533945f, 0.484337419f, 0.487142950f, 0.489950508f, 0.492759943f,
+    0.495571166f, 0.498384058f, 0.501198530f, 0.504014432f, 0.506831765f, 0.509650290f,
+    0.512469947f, 0.515290678f, 0.518112361f, 0.520934820f, 0.523757994f, 0.526581824f,
+    0.529406130f, 0.532230854f, 0.535055876f, 0.537881076f, 0.540706336f, 0.543531597f,
+    0.546356678f, 0.549181581f, 0.552006125f, 0.554830194f, 0.557653725f, 0.560476542f,
+    0.563298643f, 0.566119850f, 0.568940043f, 0.571759164f, 0.574577093f, 0.577393711f,
+    0.580208957f, 0.583022654f, 0.585834682f, 0.588645041f, 0.591453552f, 0.594260097f,
+    0.597064614f, 0.599866986f, 0.602667093f, 0.605464876f, 0.608260095f, 0.611052811f,
+    0.613842845f, 0.616630077f, 0.619414389f, 0.622195780f, 0.624974012f, 0.627749026f,
+    0.630520761f, 0.633289099f, 0.636053920f, 0.638815045f, 0.641572535f, 0.644326150f,
+    0.647075832f, 0.649821460f, 0.652562916f, 0.655300200f, 0.658033073f, 0.660761535f,
+    0.663485408f, 0.666204691f, 0.668919146f, 0.671628773f, 0.674333394f, 0.677032948f,
+    0.679727376f, 0.682416499f, 0.685100257f, 0.687778592f, 0.690451264f, 0.693118334f,
+    0.695779622f, 0.698435009f, 0.701084375f, 0.703727722f, 0.706364870f, 0.708995759f,
+    0.711620271f, 0.714238286f, 0.716849744f, 0.719454587f, 0.722052574f, 0.724643707f,
+    0.727227926f, 0.729805052f, 0.732375026f, 0.734937727f, 0.737493098f, 0.740040958f,
+    0.742581308f, 0.745114028f, 0.747639000f, 0.750156164f, 0.752665401f, 0.755166590f,
+    0.757659674f, 0.760144532f, 0.762621105f, 0.765089273f, 0.767548919f, 0.770000041f,
+    0.772442460f, 0.774876058f, 0.777300894f, 0.779716730f, 0.782123506f, 0.784521163f,
+    0.786909580f, 0.789288700f, 0.791658401f, 0.794018626f, 0.796369255f, 0.798710227f,
+    0.801041484f, 0.803362846f, 0.805674255f, 0.807975650f, 0.810266972f, 0.812548041f,
+    0.814818859f, 0.817079306f, 0.819329321f, 0.821568787f, 0.823797643f, 0.826015770f,
+    0.828223109f, 0.830419600f, 0.832605064f, 0.834779561f, 0.836942911f, 0.839095116f,
+    0.841235936f, 0.843365490f, 0.845483541f, 0.847590089f, 0.849685013f, 0.851768315f,
+    0.853839815f, 0.855899453f, 0.857947171f, 0.859982908f, 0.862006605f, 0.864018142f,
+    0.866017461f, 0.868004441f, 0.869979084f, 0.871941268f, 0.873890936f, 0.875828028f,
+    0.877752423f, 0.879664063f, 0.881562948f, 0.883448899f, 0.885321915f, 0.887181878f,
+    0.889028788f, 0.890862465f, 0.892682970f, 0.894490123f, 0.896283925f, 0.898064315f,
+    0.899831176f, 0.901584446f, 0.903324068f, 0.905050039f, 0.906762183f, 0.908460557f,
+    0.910144985f, 0.911815405f, 0.913471878f, 0.915114224f, 0.916742444f, 0.918356419f,
+    0.919956148f, 0.921541512f, 0.923112512f, 0.924669087f, 0.926211119f, 0.927738547f,
+    0.929251373f, 0.930749536f, 0.932232976f, 0.933701575f, 0.935155332f, 0.936594188f,
+    0.938018084f, 0.939426959f, 0.940820754f, 0.942199469f, 0.943562984f, 0.944911301f,
+    0.946244299f, 0.947562039f, 0.948864341f, 0.950151265f, 0.951422691f, 0.952678561f,
+    0.953918934f, 0.955143631f, 0.956352711f, 0.957546055f, 0.958723664f, 0.959885478f,
+    0.961031437f, 0.962161541f, 0.963275731f, 0.964373887f, 0.965456128f, 0.966522217f,
+    0.967572272f, 0.968606234f, 0.969623983f, 0.970625520f, 0.971610785f, 0.972579837f,
+    0.973532557f, 0.974468887f, 0.975388825f, 0.976292372f, 0.977179468f, 0.978050053f,
+    0.978904068f, 0.979741573f, 0.980562508f, 0.981366813f, 0.982154429f, 0.982925415f,
+    0.983679652f, 0.984417200f, 0.985137939f, 0.985841930f, 0.986529052f, 0.987199366f,
+    0.987852752f, 0.988489330f, 0.989108920f, 0.989711583f, 0.990297318f, 0.990866065f,
+    0.991417766f, 0.991952419f, 0.992470086f, 0.992970645f, 0.993454158f, 0.993920505f,
+    0.994369745f, 0.994801879f, 0.995216846f, 0.995614648f, 0.995995224f, 0.996358633f,
+    0.996704817f, 0.997033775f, 0.997345448f, 0.997639894f, 0.997917116f, 0.998177052f,
+    0.998419702f, 0.998645008f, 0.998853087f, 0.999043822f, 0.999217212f, 0.999373317f,
+    0.999512076f, 0.999633491f, 0.999737620f, 0.999824345f, 0.999893725f, 0.999945819f,
+    0.999980509f, 0.999997854f, 0.999997854f, 0.999980509f, 0.999945819f, 0.999893725f,
+    0.999824345f, 0.999737620f, 0.999633491f, 0.999512076f, 0.999373317f, 0.999217212f,
+    0.999043822f, 0.998853087f, 0.998645008f, 0.998419702f, 0.998177052f, 0.997917116f,
+    0.997639894f, 0.997345448f, 0.997033775f, 0.996704817f, 0.996358633f, 0.995995224f,
+    0.995614648f, 0.995216846f, 0.994801879f, 0.994369745f, 0.993920505f, 0.993454158f,
+    0.992970645f, 0.992470086f, 0.991952419f, 0.991417766f, 0.990866065f, 0.990297318f,
+    0.989711583f, 0.989108920f, 0.988489330f, 0.987852752f, 0.987199366f, 0.986529052f,
+    0.985841930f, 0.985137939f, 0.984417200f, 0.983679652f, 0.982925415f, 0.982154429f,
+    0.981366813f, 0.980562508f, 0.979741573f, 0.978904068f, 0.978050053f, 0.977179468f,
+    0.976292372f, 0.975388825f, 0.974468887f, 0.973532557f, 0.972579837f, 0.971610785f,
+    0.970625520f, 0.969623983f, 0.968606234f, 0.967572272f, 0.966522217f, 0.965456128f,
+    0.964373887f, 0.963275731f, 0.962161541f, 0.961031437f, 0.959885478f, 0.958723664f,
+    0.957546055f, 0.956352711f, 0.955143631f, 0.953918934f, 0.952678561f, 0.951422691f,
+    0.950151265f, 0.948864341f, 0.947562039f, 0.946244299f, 0.944911301f, 0.943562984f,
+    0.942199469f, 0.940820754f, 0.939426959f, 0.938018084f, 0.936594188f, 0.935155332f,
+    0.933701575f, 0.932232976f, 0.930749536f, 0.929251373f, 0.927738547f, 0.926211119f,
+    0.924669087f, 0.923112512f, 0.921541512f, 0.919956148f, 0.918356419f, 0.916742444f,
+    0.915114224f, 0.913471878f, 0.911815405f, 0.910144985f, 0.908460557f, 0.906762183f,
+    0.905050039f, 0.903324068f, 0.901584446f, 0.899831176f, 0.898064315f, 0.896283925f,
+    0.894490123f, 0.892682970f, 0.890862465f, 0.889028788f, 0.887181878f, 0.885321915f,
+    0.883448899f, 0.881562948f, 0.879664063f, 0.877752423f, 0.875828028f, 0.873890936f,
+    0.871941268f, 0.869979084f, 0.868004441f, 0.866017461f, 0.864018142f, 0.862006605f,
+    0.859982908f, 0.857947171f, 0.855899453f, 0.853839815f, 0.851768315f, 0.849685013f,
+    0.847590089f, 0.845483541f, 0.843365490f, 0.841235936f, 0.839095116f, 0.836942911f,
+    0.834779561f, 0.832605064f, 0.830419600f, 0.828223109f, 0.826015770f, 0.823797643f,
+    0.821568787f, 0.819329321f, 0.817079306f, 0.814818859f, 0.812548041f, 0.810266972f,
+    0.807975650f, 0.805674255f, 0.803362846f, 0.801041484f, 0.798710227f, 0.796369255f,
+    0.794018626f, 0.791658401f, 0.789288700f, 0.786909580f, 0.784521163f, 0.782123506f,
+    0.779716730f, 0.777300894f, 0.774876058f, 0.772442460f, 0.770000041f, 0.767548919f,
+    0.765089273f, 0.762621105f, 0.760144532f, 0.757659674f, 0.755166590f, 0.752665401f,
+    0.750156164f, 0.747639000f, 0.745114028f, 0.742581308f, 0.740040958f, 0.737493098f,
+    0.734937727f, 0.732375026f, 0.729805052f, 0.727227926f, 0.724643707f, 0.722052574f,
+    0.719454587f, 0.716849744f, 0.714238286f, 0.711620271f, 0.708995759f, 0.706364870f,
+    0.703727722f, 0.701084375f, 0.698435009f, 0.695779622f, 0.693118334f, 0.690451264f,
+    0.687778592f, 0.685100257f, 0.682416499f, 0.679727376f, 0.677032948f, 0.674333394f,
+    0.671628773f, 0.668919146f, 0.666204691f, 0.663485408f, 0.660761535f, 0.658033073f,
+    0.655300200f, 0.652562916f, 0.649821460f, 0.647075832f, 0.644326150f, 0.641572535f,
+    0.638815045f, 0.636053920f, 0.633289099f, 0.630520761f, 0.627749026f, 0.624974012f,
+    0.622195780f, 0.619414389f, 0.616630077f, 0.613842845f, 0.611052811f, 0.608260095f,
+    0.605464876f, 0.602667093f, 0.599866986f, 0.597064614f, 0.594260097f, 0.591453552f,
+    0.588645041f, 0.585834682f, 0.583022654f, 0.580208957f, 0.577393711f, 0.574577093f,
+    0.571759164f, 0.568940043f, 0.566119850f, 0.563298643f, 0.560476542f, 0.557653725f,
+    0.554830194f, 0.552006125f, 0.549181581f, 0.546356678f, 0.543531597f, 0.540706336f,
+    0.537881076f, 0.535055876f, 0.532230854f, 0.529406130f, 0.526581824f, 0.523757994f,
+    0.520934820f, 0.518112361f, 0.515290678f, 0.512469947f, 0.509650290f, 0.506831765f,
+    0.504014432f, 0.501198530f, 0.498384058f, 0.495571166f, 0.492759943f, 0.489950508f,
+    0.487142950f, 0.484337419f, 0.481533945f, 0.478732705f, 0.475933760f, 0.473137230f,
+    0.470343232f, 0.467551857f, 0.464763224f, 0.461977422f, 0.459194571f, 0.456414759f,
+    0.453638107f, 0.450864702f, 0.448094666f, 0.445328116f, 0.442565113f, 0.439805776f,
+    0.437050253f, 0.434298575f, 0.431550920f, 0.428807318f, 0.426067948f, 0.423332840f,
+    0.420602173f, 0.417875975f, 0.415154397f, 0.412437528f, 0.409725487f, 0.407018334f,
+    0.404316217f, 0.401619226f, 0.398927420f, 0.396240979f, 0.393559933f, 0.390884399f,
+    0.388214529f, 0.385550350f, 0.382892013f, 0.380239606f, 0.377593219f, 0.374952942f,
+    0.372318923f, 0.369691223f, 0.367069930f, 0.364455163f, 0.361847043f, 0.359245628f,
+    0.356651008f, 0.354063332f, 0.351482660f, 0.348909110f, 0.346342772f, 0.343783706f,
+    0.341232091f, 0.338687927f, 0.336151391f, 0.333622545f, 0.331101447f, 0.328588277f,
+    0.326083034f, 0.323585898f, 0.321096897f, 0.318616182f, 0.316143811f, 0.313679874f,
+    0.311224490f, 0.308777720f, 0.306339681f, 0.303910464f, 0.301490128f, 0.299078822f,
+    0.296676576f, 0.294283509f, 0.291899741f, 0.289525300f, 0.287160307f, 0.284804881f,
+    0.282459050f, 0.280122966f, 0.277796656f, 0.275480270f, 0.273173839f, 0.270877481f,
+    0.268591255f, 0.266315311f, 0.264049649f, 0.261794418f, 0.259549677f, 0.257315516f,
+    0.255092025f, 0.252879262f, 0.250677347f, 0.248486340f, 0.246306330f, 0.244137391f,
+    0.241979629f, 0.239833102f, 0.237697899f, 0.235574096f, 0.233461782f, 0.231361032f,
+    0.229271919f, 0.227194533f, 0.225128949f, 0.223075226f, 0.221033484f, 0.219003752f,
+    0.216986150f, 0.214980721f, 0.212987542f, 0.211006716f, 0.209038287f, 0.207082361f,
+    0.205138981f, 0.203208238f, 0.201290190f, 0.199384928f, 0.197492510f, 0.195613027f,
+    0.193746522f, 0.191893086f, 0.190052763f, 0.188225657f, 0.186411828f, 0.184611320f,
+    0.182824224f, 0.181050614f, 0.179290533f, 0.177544057f, 0.175811261f, 0.174092203f,
+    0.172386944f, 0.170695558f, 0.169018090f, 0.167354628f, 0.165705219f, 0.164069936f,
+    0.162448838f, 0.160841972f, 0.159249410f, 0.157671213f, 0.156107441f, 0.154558137f,
+    0.153023392f, 0.151503235f, 0.149997741f, 0.148506939f, 0.147030920f, 0.145569727f,
+    0.144123420f, 0.142692029f, 0.141275644f, 0.139874279f, 0.138488024f, 0.137116909f,
+    0.135760993f, 0.134420335f, 0.133094966f, 0.131784946f, 0.130490333f, 0.129211158f,
+    0.127947479f, 0.126699358f, 0.125466809f, 0.124249913f, 0.123048693f, 0.121863209f,
+    0.120693490f, 0.119539589f, 0.118401557f, 0.117279418f, 0.116173230f, 0.115083031f,
+    0.114008866f, 0.112950765f, 0.111908771f, 0.110882930f, 0.109873280f, 0.108879849f,
+    0.107902683f, 0.106941819f, 0.105997294f, 0.105069138f, 0.104157388f, 0.103262074f,
+    0.102383241f, 0.101520918f, 0.100675136f, 0.0998459235f, 0.0990333110f, 0.0982373431f,
+    0.0974580348f, 0.0966954157f, 0.0959495232f, 0.0952203870f, 0.0945080221f, 0.0938124657f,
+    0.0931337401f, 0.0924718753f, 0.0918268859f, 0.0911988094f, 0.0905876607f, 0.0899934620f,
+    0.0894162431f, 0.0888560191f, 0.0883128121f, 0.0877866447f, 0.0872775391f, 0.0867855102f,
+    0.0863105804f, 0.0858527645f, 0.0854120776f, 0.0849885419f, 0.0845821649f, 0.0841929764f,
+    0.0838209763f, 0.0834661871f, 0.0831286162f, 0.0828082860f, 0.0825051963f, 0.0822193697f,
+    0.0819508061f, 0.0816995278f, 0.0814655349f, 0.0812488422f, 0.0810494497f, 0.0808673725f,
+    0.0807026178f, 0.0805551857f, 0.0804250911f, 0.0803123266f, 0.0802169070f, 0.0801388249f,
+    0.0800780952f, 0.0800347179f, 0.0800086930f, 0.0800000131f,
+};
+
+constexpr int kMel44100Spans[120] = {
+    1, 3, 0, 2, 5, 2, 4, 7, 5, 6, 9, 8,
+    8, 11, 11, 10, 13, 14, 12, 16, 17, 14, 19, 21,
+    17, 22, 26, 20, 26, 31, 23, 29, 37, 27, 33, 43,
+    30, 38, 49, 34, 42, 57, 39, 48, 65, 43, 53, 74,
+    49, 59, 84, 54, 66, 94, 60, 73, 106, 67, 81, 119,
+    74, 90, 133, 82, 99, 149, 91, 110, 166, 100, 121, 185,
+    111, 133, 206, 122, 146, 228, 134, 160, 252, 147, 176, 278,
+    161, 193, 307, 177, 211, 339, 194, 231, 373, 212, 253, 410,
+    232, 277, 451, 254, 303, 496, 278, 331, 545, 304, 361, 598,
+    332, 394, 655, 362, 430, 717, 395, 470, 785, 431, 512, 860,
+};
+
+constexpr float kMel44100Weights[941] = {
+    1.00000000f, 0.500000000f, 0.500000000f, 1.00000000f, 0.500000000f, 0.500000000f,
+    1.00000000f, 0.500000000f, 0.500000000f, 1.00000000f, 0.500000000f, 0.500000000f,
+    1.00000000f, 0.500000000f, 0.500000000f, 1.00000000f, 0.500000000f, 0.500000000f,
+    1.00000000f, 0.666666687f, 0.333333343f, 0.333333343f, 0.666666687f, 1.00000000f,
+    0.666666687f, 0.333333343f, 0.333333343f, 0.666666687f, 1.00000000f, 0.666666687f,
+    0.333333343f, 0.333333343f, 0.666666687f, 1.00000000f, 0.750000000f, 0.500000000f,
+    0.250000000f, 0.250000000f, 0.500000000f, 0.750000000f, 1.00000000f, 0.666666687f,
+    0.333333343f, 0.333333343f, 0.666666687f, 1.00000000f, 0.750000000f, 0.500000000f,
+    0.250000000f, 0.250000000f, 0.500000000f, 0.750000000f, 1.00000000f, 0.800000012f,
+    0.600000024f, 0.400000006f, 0.200000003f, 0.200000003f, 0.400000006f, 0.600000024f,
+    0.800000012f, 1.00000000f, 0.750000000f, 0.500000000f, 0.250000000f, 0.250000000f,
+    0.500000000f, 0.750000000f, 1.00000000f, 0.833333313f, 0.666666687f, 0.500000000f,
+    0.333333343f, 0.166666672f, 0.166666672f, 0.333333343f, 0.500000000f, 0.666666687f,
+    0.833333313f, 1.00000000f, 0.800000012f, 0.600000024f, 0.400000006f, 0.200000003f,
+    0.200000003f, 0.400000006f, 0.600000024f, 0.800000012f, 1.00000000f, 0.833333313f,
+    0.666666687f, 0.500000000f, 0.333333343f, 0.166666672f, 0.166666672f, 0.333333343f,
+    0.500000000f, 0.666666687f, 0.833333313f, 1.00000000f, 0.857142866f, 0.714285731f,
+    0.571428597f, 0.428571433f, 0.285714298f, 0.142857149f, 0.142857149f, 0.285714298f,
+    0.428571433f, 0.571428597f, 0.714285731f, 0.857142866f, 1.00000000f, 0.857142866f,
+    0.714285731f, 0.571428597f, 0.428571433f, 0.285714298f, 0.142857149f, 0.142857149f,
+    0.285714298f, 0.428571433f, 0.571428597f, 0.714285731f, 0.857142866f, 1.00000000f,
+    0.875000000f, 0.750000000f, 0.625000000f, 0.500000000f, 0.375000000f, 0.250000000f,
+    0.125000000f, 0.125000000f, 0.250000000f, 0.375000000f, 0.500000000f, 0.625000000f,
+    0.750000000f, 0.875000000f, 1.00000000f, 0.888888896f, 0.777777791f, 0.666666687f,
+    0.555555582f, 0.444444448f, 0.333333343f, 0.222222224f, 0.111111112f, 0.111111112f,
+    0.222222224f, 0.333333343f, 0.444444448f, 0.555555582f, 0.666666687f, 0.777777791f,
+    0.888888896f, 1.00000000f, 0.888888896f, 0.777777791f, 0.666666687f, 0.555555582f,
+    0.444444448f, 0.333333343f, 0.222222224f, 0.111111112f, 0.111111112f, 0.222222224f,
+    0.333333343f, 0.444444448f, 0.555555582f, 0.666666687f, 0.777777791f, 0.888888896f,
+    1.00000000f, 0.909090936f, 0.818181813f, 0.727272749f, 0.636363626f, 0.545454562f,
+    0.454545468f, 0.363636374f, 0.272727281f, 0.181818187f, 0.0909090936f, 0.0909090936f,
+    0.181818187f, 0.272727281f, 0.363636374f, 0.454545468f, 0.545454562f, 0.636363626f,
+    0.727272749f, 0.818181813f, 0.909090936f, 1.00000000f, 0.909090936f, 0.818181813f,
+    0.727272749f, 0.636363626f, 0.545454562f, 0.454545468f, 0.363636374f, 0.272727281f,
+    0.181818187f, 0.0909090936f, 0.0909090936f, 0.181818187f, 0.272727281f, 0.363636374f,
+    0.454545468f, 0.545454562f, 0.636363626f, 0.727272749f, 0.818181813f, 0.909090936f,
+    1.00000000f, 0.916666687f, 0.833333313f, 0.750000000f, 0.666666687f, 0.583333313f,
+    0.500000000f, 0.416666657f, 0.333333343f, 0.250000000f, 0.166666672f, 0.0833333358f,
+    0.0833333358f, 0.166666672f, 0.250000000f, 0.333333343f, 0.416666657f, 0.500000000f,
+    0.583333313f, 0.666666687f, 0.750000000f, 0.833333313f, 0.916666687f, 1.00000000f,
+    0.923076928f, 0.846153855f, 0.769230783f, 0.692307711f, 0.615384638f, 0.538461566f,
+    0.461538464f, 0.384615391f, 0.307692319f, 0.230769232f, 0.153846160f, 0.0769230798f,
+    0.0769230798f, 0.153846160f, 0.230769232f, 0.307692319f, 0.384615391f, 0.461538464f,
+    0.538461566f, 0.615384638f, 0.692307711f, 0.769230783f, 0.846153855f, 0.923076928f,
+    1.00000000f, 0.928571403f, 0.857142866f, 0.785714269f, 0.714285731f, 0.642857134f,
+    0.571428597f, 0.500000000f, 0.428571433f, 0.357142866f, 0.285714298f, 0.214285716f,
+    0.142857149f, 0.0714285746f, 0.0714285746f, 0.142857149f, 0.214285716f, 0.285714298f,
+    0.357142866f, 0.428571433f, 0.500000000f, 0.571428597f, 0.642857134f, 0.714285731f,
+    0.785714269f, 0.857142866f, 0.928571403f, 1.00000000f, 0.937500000f, 0.875000000f,
+    0.812500000f, 0.750000000f, 0.687500000f, 0.625000000f, 0.562500000f, 0.500000000f,
+    0.437500000f, 0.375000000f, 0.312500000f, 0.250000000f, 0.187500000f, 0.125000000f,
+    0.0625000000f, 0.0625000000f, 0.125000000f, 0.187500000f, 0.250000000f, 0.312500000f,
+    0.375000000f, 0.437500000f, 0.500000000f, 0.562500000f, 0.625000000f, 0.687500000f,
+    0.750000000f, 0.812500000f, 0.875000000f, 0.937500000f, 1.00000000f, 0.941176474f,
+    0.882352948f, 0.823529422f, 0.764705896f, 0.705882370f, 0.647058845f, 0.588235319f,
+    0.529411793f, 0.470588237f, 0.411764711f, 0.352941185f, 0.294117659f, 0.235294119f,
+    0.176470593f, 0.117647059f, 0.0588235296f, 0.0588235296f, 0.117647059f, 0.176470593f,
+    0.235294119f, 0.294117659f, 0.352941185f, 0.411764711f, 0.470588237f, 0.529411793f,
+    0.588235319f, 0.647058845f, 0.705882370f, 0.764705896f, 0.823529422f, 0.882352948f,
+    0.941176474f, 1.00000000f, 0.944444418f, 0.888888896f, 0.833333313f, 0.777777791f,
+    0.722222209f, 0.666666687f, 0.611111104f, 0.555555582f, 0.500000000f, 0.444444448f,
+    0.388888896f, 0.333333343f, 0.277777791f, 0.222222224f, 0.166666672f, 0.111111112f,
+    0.0555555560f, 0.0555555560f, 0.111111112f, 0.166666672f, 0.222222224f, 0.277777791f,
+    0.333333343f, 0.388888896f, 0.444444448f, 0.500000000f, 0.555555582f, 0.611111104f,
+    0.666666687f, 0.722222209f, 0.777777791f, 0.833333313f, 0.888888896f, 0.944444418f,
+    1.00000000f, 0.949999988f, 0.899999976f, 0.850000024f, 0.800000012f, 0.750000000f,
+    0.699999988f, 0.649999976f, 0.600000024f, 0.550000012f, 0.500000000f, 0.449999988f,
+    0.400000006f, 0.349999994f, 0.300000012f, 0.250000000f, 0.200000003f, 0.150000006f,
+    0.100000001f, 0.0500000007f, 0.0500000007f, 0.100000001f, 0.150000006f, 0.200000003f,
+    0.250000000f, 0.300000012f, 0.349999994f, 0.400000006f, 0.449999988f, 0.500000000f,
+    0.550000012f, 0.600000024f, 0.649999976f, 0.699999988f, 0.750000000f, 0.800000012f,
+    0.850000024f, 0.899999976f, 0.949999988f, 1.00000000f, 0.954545438f, 0.909090936f,
+    0.863636374f, 0.818181813f, 0.772727251f, 0.727272749f, 0.681818187f, 0.636363626f,
+    0.590909064f, 0.545454562f, 0.500000000f, 0.454545468f, 0.409090906f, 0.363636374f,
+    0.318181813f, 0.272727281f, 0.227272734f, 0.181818187f, 0.136363640f, 0.0909090936f,
+    0.0454545468f, 0.0454545468f, 0.0909090936f, 0.136363640f, 0.181818187f, 0.227272734f,
+    0.272727281f, 0.318181813f, 0.363636374f, 0.409090906f, 0.454545468f, 0.500000000f,
+    0.545454562f, 0.590909064f, 0.636363626f, 0.681818187f, 0.727272749f, 0.772727251f,
+    0.818181813f, 0.863636374f, 0.909090936f, 0.954545438f, 1.00000000f, 0.958333313f,
+    0.916666687f, 0.875000000f, 0.833333313f, 0.791666687f, 0.750000000f, 0.708333313f,
+    0.666666687f, 0.625000000f, 0.583333313f, 0.541666687f, 0.500000000f, 0.458333343f,
+    0.416666657f, 0.375000000f, 0.333333343f, 0.291666657f, 0.250000000f, 0.208333328f,
+    0.166666672f, 0.125000000f, 0.0833333358f, 0.0416666679f, 0.0416666679f, 0.0833333358f,
+    0.125000000f, 0.166666672f, 0.208333328f, 0.250000000f, 0.291666657f, 0.333333343f,
+    0.375000000f, 0.416666657f, 0.458333343f, 0.500000000f, 0.541666687f, 0.583333313f,
+    0.625000000f, 0.666666687f, 0.708333313f, 0.750000000f, 0.791666687f, 0.833333313f,
+    0.875000000f, 0.916666687f, 0.958333313f, 1.00000000f, 0.961538434f, 0.923076928f,
+    0.884615362f, 0.846153855f, 0.807692289f, 0.769230783f, 0.730769217f, 0.692307711f,
+    0.653846145f, 0.615384638f, 0.576923072f, 0.538461566f, 0.500000000f, 0.461538464f,
+    0.423076928f, 0.384615391f, 0.346153855f, 0.307692319f, 0.269230783f, 0.230769232f,
+    0.192307696f, 0.153846160f, 0.115384616f, 0.0769230798f, 0.0384615399f, 0.0384615399f,
+    0.0769230798f, 0.115384616f, 0.153846160f, 0.192307696f, 0.230769232f, 0.269230783f,
+    0.307692319f, 0.346153855f, 0.384615391f, 0.423076928f, 0.461538464f, 0.500000000f,
+    0.538461566f, 0.576923072f, 0.615384638f, 0.653846145f, 0.692307711f, 0.730769217f,
+    0.769230783f, 0.807692289f, 0.846153855f, 0.884615362f, 0.923076928f, 0.961538434f,
+    1.00000000f, 0.964285731f, 0.928571403f, 0.892857134f, 0.857142866f, 0.821428597f,
+    0.785714269f, 0.750000000f, 0.714285731f, 0.678571403f, 0.642857134f, 0.607142866f,
+    0.571428597f, 0.535714269f, 0.500000000f, 0.464285702f, 0.428571433f, 0.392857134f,
+    0.357142866f, 0.321428567f, 0.285714298f, 0.250000000f, 0.214285716f, 0.178571433f,
+    0.142857149f, 0.107142858f, 0.0714285746f, 0.0357142873f, 0.0357142873f, 0.0714285746f,
+    0.107142858f, 0.142857149f, 0.178571433f, 0.214285716f, 0.250000000f, 0.285714298f,
+    0.321428567f, 0.357142866f, 0.392857134f, 0.428571433f, 0.464285702f, 0.500000000f,
+    0.535714269f, 0.571428597f, 0.607142866f, 0.642857134f, 0.678571403f, 0.714285731f,
+    0.750000000f, 0.785714269f, 0.821428597f, 0.857142866f, 0.892857134f, 0.928571403f,
+    0.964285731f, 1.00000000f, 0.966666639f, 0.933333337f, 0.899999976f, 0.866666675f,
+    0.833333313f, 0.800000012f, 0.766666651f, 0.733333349f, 0.699999988f, 0.666666687f,
+    0.633333325f, 0.600000024f, 0.566666663f, 0.533333361f, 0.500000000f, 0.466666669f,
+    0.433333337f, 0.400000006f, 0.366666675f, 0.333333343f, 0.300000012f, 0.266666681f,
+    0.233333334f, 0.200000003f, 0.166666672f, 0.133333340f, 0.100000001f, 0.0666666701f,
+    0.0333333351f, 0.0333333351f, 0.0666666701f, 0.100000001f, 0.133333340f, 0.166666672f,
+    0.200000003f, 0.233333334f, 0.266666681f, 0.300000012f, 0.333333343f, 0.366666675f,
+    0.400000006f, 0.433333337f, 0.466666669f, 0.500000000f, 0.533333361f, 0.566666663f,
+    0.600000024f, 0.633333325f, 0.666666687f, 0.699999988f, 0.733333349f, 0.766666651f,
+    0.800000012f, 0.833333313f, 0.866666675f, 0.899999976f, 0.933333337f, 0.966666639f,
+    1.00000000f, 0.969696999f, 0.939393938f, 0.909090936f, 0.878787875f, 0.848484874f,
+    0.818181813f, 0.787878811f, 0.757575750f, 0.727272749f, 0.696969688f, 0.666666687f,
+    0.636363626f, 0.606060624f, 0.575757563f, 0.545454562f, 0.515151501f, 0.484848499f,
+    0.454545468f, 0.424242437f, 0.393939406f, 0.363636374f, 0.333333343f, 0.303030312f,
+    0.272727281f, 0.242424250f, 0.212121218f, 0.181818187f, 0.151515156f, 0.121212125f,
+    0.0909090936f, 0.0606060624f, 0.0303030312f, 0.0303030312f, 0.0606060624f, 0.0909090936f,
+    0.121212125f, 0.151515156f, 0.181818187f, 0.212121218f, 0.242424250f, 0.272727281f,
+    0.303030312f, 0.333333343f, 0.363636374f, 0.393939406f, 0.424242437f, 0.454545468f,
+    0.484848499f, 0.515151501f, 0.545454562f, 0.575757563f, 0.606060624f, 0.636363626f,
+    0.666666687f, 0.696969688f, 0.727272749f, 0.757575750f, 0.787878811f, 0.818181813f,
+    0.848484874f, 0.878787875f, 0.909090936f, 0.939393938f, 0.969696999f, 1.00000000f,
+    0.972222209f, 0.944444418f, 0.916666687f, 0.888888896f, 0.861111104f, 0.833333313f,
+    0.805555582f, 0.777777791f, 0.750000000f, 0.722222209f, 0.694444418f, 0.666666687f,
+    0.638888896f, 0.611111104f, 0.583333313f, 0.555555582f, 0.527777791f, 0.500000000f,
+    0.472222209f, 0.444444448f, 0.416666657f, 0.388888896f, 0.361111104f, 0.333333343f,
+    0.305555552f, 0.277777791f, 0.250000000f, 0.222222224f, 0.194444448f, 0.166666672f,
+    0.138888896f, 0.111111112f, 0.0833333358f, 0.0555555560f, 0.0277777780f, 0.0277777780f,
+    0.0555555560f, 0.0833333358f, 0.111111112f, 0.138888896f, 0.166666672f, 0.194444448f,
+    0.222222224f, 0.250000000f, 0.277777791f, 0.305555552f, 0.333333343f, 0.361111104f,
+    0.388888896f, 0.416666657f, 0.444444448f, 0.472222209f, 0.500000000f, 0.527777791f,
+    0.555555582f, 0.583333313f, 0.611111104f, 0.638888896f, 0.666666687f, 0.694444418f,
+    0.722222209f, 0.750000000f, 0.777777791f, 0.805555582f, 0.833333313f, 0.861111104f,
+    0.888888896f, 0.916666687f, 0.944444418f, 0.972222209f, 1.00000000f, 0.975000024f,
+    0.949999988f, 0.925000012f, 0.899999976f, 0.875000000f, 0.850000024f, 0.824999988f,
+    0.800000012f, 0.774999976f, 0.750000000f, 0.725000024f, 0.699999988f, 0.675000012f,
+    0.649999976f, 0.625000000f, 0.600000024f, 0.574999988f, 0.550000012f, 0.524999976f,
+    0.500000000f, 0.474999994f, 0.449999988f, 0.425000012f, 0.400000006f, 0.375000000f,
+    0.349999994f, 0.324999988f, 0.300000012f, 0.275000006f, 0.250000000f, 0.224999994f,
+    0.200000003f, 0.174999997f, 0.150000006f, 0.125000000f, 0.100000001f, 0.0750000030f,
+    0.0500000007f, 0.0250000004f, 0.0250000004f, 0.0500000007f, 0.0750000030f, 0.100000001f,
+    0.125000000f, 0.150000006f, 0.174999997f, 0.200000003f, 0.224999994f, 0.250000000f,
+    0.275000006f, 0.300000012f, 0.324999988f, 0.349999994f, 0.375000000f, 0.400000006f,
+    0.425000012f, 0.449999988f, 0.474999994f, 0.500000000f, 0.524999976f, 0.550000012f,
+    0.574999988f, 0.600000024f, 0.625000000f, 0.649999976f, 0.675000012f, 0.699999988f,
+    0.725000024f, 0.750000000f, 0.774999976f, 0.800000012f, 0.824999988f, 0.850000024f,
+    0.875000000f, 0.899999976f, 0.925000012f, 0.949999988f, 0.975000024f, 1.00000000f,
+    0.976190448f, 0.952380955f, 0.928571403f, 0.904761910f, 0.880952358f, 0.857142866f,
+    0.833333313f, 0.809523821f, 0.785714269f, 0.761904776f, 0.738095224f, 0.714285731f,
+    0.690476179f, 0.666666687f, 0.642857134f, 0.619047642f, 0.595238090f, 0.571428597f,
+    0.547619045f, 0.523809552f, 0.500000000f, 0.476190478f, 0.452380955f, 0.428571433f,
+    0.404761910f, 0.380952388f, 0.357142866f, 0.333333343f, 0.309523821f, 0.285714298f,
+    0.261904776f, 0.238095239f, 0.214285716f, 0.190476194f, 0.166666672f, 0.142857149f,
+    0.119047619f, 0.0952380970f, 0.0714285746f, 0.0476190485f, 0.0238095243f,
+};
+
+constexpr int kMel48000Spans[120] = {
+    1, 3, 0, 2, 4, 2, 4, 6, 4, 5, 8, 6,
+    7, 10, 9, 9, 13, 12, 11, 15, 16, 14, 18, 20,
+    16, 21, 24, 19, 24, 29, 22, 28, 34, 25, 32, 40,
+    29, 36, 47, 33, 41, 54, 37, 46, 62, 42, 51, 71,
+    47, 57, 80, 52, 64, 90, 58, 71, 102, 65, 79, 115,
+    72, 87, 129, 80, 96, 144, 88, 106, 160, 97, 117, 178,
+    107, 129, 198, 118, 142, 220, 130, 157, 244, 143, 172, 271,
+    158, 189, 300, 173, 207, 331, 190, 228, 365, 208, 249, 403,
+    229, 273, 444, 250, 299, 488, 274, 328, 537, 300, 358, 591,
+    329, 392, 649, 359, 429, 712, 393, 469, 782, 430, 512, 858,
+};
+
+constexpr float kMel48000Weights[940] = {
+    1.00000000f, 0.500000000f, 0.500000000f, 1.00000000f, 1.00000000f, 0.500000000f,
+    0.500000000f, 1.00000000f, 0.500000000f, 0.500000000f, 1.00000000f, 0.500000000f,
+    0.500000000f, 1.00000000f, 0.666666687f, 0.333333343f, 0.333333343f, 0.666666687f,
+    1.00000000f, 0.500000000f, 0.500000000f, 1.00000000f, 0.666666687f, 0.333333343f,
+    0.333333343f, 0.666666687f, 1.00000000f, 0.666666687f, 0.333333343f, 0.333333343f,
+    0.666666687f, 1.00000000f, 0.666666687f, 0.333333343f, 0.333333343f, 0.666666687f,
+    1.00000000f, 0.750000000f, 0.500000000f, 0.250000000f, 0.250000000f, 0.500000000f,
+    0.750000000f, 1.00000000f, 0.750000000f, 0.500000000f, 0.250000000f, 0.250000000f,
+    0.500000000f, 0.750000000f, 1.00000000f, 0.750000000f, 0.500000000f, 0.250000000f,
+    0.250000000f, 0.500000000f, 0.750000000f, 1.00000000f, 0.800000012f, 0.600000024f,
+    0.400000006f, 0.200000003f, 0.200000003f, 0.400000006f, 0.600000024f, 0.800000012f,
+    1.00000000f, 0.800000012f, 0.600000024f, 0.400000006f, 0.200000003f, 0.200000003f,
+    0.400000006f, 0.600000024f, 0.800000012f, 1.00000000f, 0.800000012f, 0.600000024f,
+    0.400000006f, 0.200000003f, 0.200000003f, 0.400000006f, 0.600000024f, 0.800000012f,
+    1.00000000f, 0.833333313f, 0.666666687f, 0.500000000f, 0.333333343f, 0.166666672f,
+    0.166666672f, 0.333333343f, 0.500000000f, 0.666666687f, 0.833333313f, 1.00000000f,
+    0.857142866f, 0.714285731f, 0.571428597f, 0.428571433f, 0.285714298f, 0.142857149f,
+    0.142857149f, 0.285714298f, 0.428571433f, 0.571428597f, 0.714285731f, 0.857142866f,
+    1.00000000f, 0.857142866f, 0.714285731f, 0.571428597f, 0.428571433f, 0.285714298f,
+    0.142857149f, 0.142857149f, 0.285714298f, 0.428571433f, 0.571428597f, 0.714285731f,
+    0.857142866f, 1.00000000f, 0.875000000f, 0.750000000f, 0.625000000f, 0.500000000f,
+    0.375000000f, 0.250000000f, 0.125000000f, 0.125000000f, 0.250000000f, 0.375000000f,
+    0.500000000f, 0.625000000f, 0.750000000f, 0.875000000f, 1.00000000f, 0.875000000f,
+    0.750000000f, 0.625000000f, 0.500000000f, 0.375000000f, 0.250000000f, 0.125000000f,
+    0.125000000f, 0.250000000f, 0.375000000f, 0.500000000f, 0.625000000f, 0.750000000f,
+    0.875000000f, 1.00000000f, 0.888888896f, 0.777777791f, 0.666666687f, 0.555555582f,
+    0.444444448f, 0.333333343f, 0.222222224f, 0.111111112f, 0.111111112f, 0.222222224f,
+    0.333333343f, 0.444444448f, 0.555555582f, 0.666666687f, 0.777777791f, 0.888888896f,
+    1.00000000f, 0.899999976f, 0.800000012f, 0.699999988f, 0.600000024f, 0.500000000f,
+    0.400000006f, 0.300000012f, 0.200000003f, 0.100000001f, 0.100000001f, 0.200000003f,
+    0.300000012f, 0.400000006f, 0.500000000f, 0.600000024f, 0.699999988f, 0.800000012f,
+    0.899999976f, 1.00000000f, 0.909090936f, 0.818181813f, 0.727272749f, 0.636363626f,
+    0.545454562f, 0.454545468f, 0.363636374f, 0.272727281f, 0.181818187f, 0.0909090936f,
+    0.0909090936f, 0.181818187f, 0.272727281f, 0.363636374f, 0.454545468f, 0.545454562f,
+    0.636363626f, 0.727272749f, 0.818181813f, 0.909090936f, 1.00000000f, 0.916666687f,
+    0.833333313f, 0.750000000f, 0.666666687f, 0.583333313f, 0.500000000f, 0.416666657f,
+    0.333333343f, 0.250000000f, 0.166666672f, 0.0833333358f, 0.0833333358f, 0.166666672f,
+    0.250000000f, 0.333333343f, 0.416666657f, 0.500000000f, 0.583333313f, 0.666666687f,
+    0.750000000f, 0.833333313f, 0.916666687f, 1.00000000f, 0.923076928f, 0.846153855f,
+    0.769230783f, 0.692307711f, 0.615384638f, 0.538461566f, 0.461538464f, 0.384615391f,
+    0.307692319f, 0.230769232f, 0.153846160f, 0.0769230798f, 0.0769230798f, 0.153846160f,
+    0.230769232f, 0.307692319f, 0.384615391f, 0.461538464f, 0.538461566f, 0.615384638f,
+    0.692307711f, 0.769230783f, 0.846153855f, 0.923076928f, 1.00000000f, 0.933333337f,
+    0.866666675f, 0.800000012f, 0.733333349f, 0.666666687f, 0.600000024f, 0.533333361f,
+    0.466666669f, 0.400000006f, 0.333333343f, 0.266666681f, 0.200000003f, 0.133333340f,
+    0.0666666701f, 0.0666666701f, 0.133333340f, 0.200000003f, 0.266666681f, 0.333333343f,
+    0.400000006f, 0.466666669f, 0.533333361f, 0.600000024f, 0.666666687f, 0.733333349f,
+    0.800000012f, 0.866666675f, 0.933333337f, 1.00000000f, 0.933333337f, 0.866666675f,
+    0.800000012f, 0.733333349f, 0.666666687f, 0.600000024f, 0.533333361f, 0.466666669f,
+    0.400000006f, 0.333333343f, 0.266666681f, 0.200000003f, 0.133333340f, 0.0666666701f,
+    0.0666666701f, 0.133333340f, 0.200000003f, 0.266666681f, 0.333333343f, 0.400000006f,
+    0.466666669f, 0.533333361f, 0.600000024f, 0.666666687f, 0.733333349f, 0.800000012f,
+    0.866666675f, 0.933333337f, 1.00000000f, 0.941176474f, 0.882352948f, 0.823529422f,
+    0.764705896f, 0.705882370f, 0.647058845f, 0.588235319f, 0.529411793f, 0.470588237f,
+    0.411764711f, 0.352941185f, 0.294117659f, 0.235294119f, 0.176470593f, 0.117647059f,
+    0.0588235296f, 0.0588235296f, 0.117647059f, 0.176470593f, 0.235294119f, 0.294117659f,
+    0.352941185f, 0.411764711f, 0.470588237f, 0.529411793f, 0.588235319f, 0.647058845f,
+    0.705882370f, 0.764705896f, 0.823529422f, 0.882352948f, 0.941176474f, 1.00000000f,
+    0.944444418f, 0.888888896f, 0.833333313f, 0.777777791f, 0.722222209f, 0.666666687f,
+    0.611111104f, 0.555555582f, 0.500000000f, 0.444444448f, 0.388888896f, 0.333333343f,
+    0.277777791f, 0.222222224f, 0.166666672f, 0.111111112f, 0.0555555560f, 0.0555555560f,
+    0.111111112f, 0.166666672f, 0.222222224f, 0.277777791f, 0.333333343f, 0.388888896f,
+    0.444444448f, 0.500000000f, 0.555555582f, 0.611111104f, 0.666666687f, 0.722222209f,
+    0.777777791f, 0.833333313f, 0.888888896f, 0.944444418f, 1.00000000f, 0.952380955f,
+    0.904761910f, 0.857142866f, 0.809523821f, 0.761904776f, 0.714285731f, 0.666666687f,
+    0.619047642f, 0.571428597f, 0.523809552f, 0.476190478f, 0.428571433f, 0.380952388f,
+    0.333333343f, 0.285714298f, 0.238095239f, 0.190476194f, 0.142857149f, 0.0952380970f,
+    0.0476190485f, 0.0476190485f, 0.0952380970f, 0.142857149f, 0.190476194f, 0.238095239f,
+    0.285714298f, 0.333333343f, 0.380952388f, 0.428571433f, 0.476190478f, 0.523809552f,
+    0.571428597f, 0.619047642f, 0.666666687f, 0.714285731f, 0.761904776f, 0.809523821f,
+    0.857142866f, 0.904761910f, 0.952380955f, 1.00000000f, 0.952380955f, 0.904761910f,
+    0.857142866f, 0.809523821f, 0.761904776f, 0.714285731f, 0.666666687f, 0.619047642f,
+    0.571428597f, 0.523809552f, 0.476190478f, 0.428571433f, 0.380952388f, 0.333333343f,
+    0.285714298f, 0.238095239f, 0.190476194f, 0.142857149f, 0.0952380970f, 0.0476190485f,
+    0.0476190485f, 0.0952380970f, 0.142857149f, 0.190476194f, 0.238095239f, 0.285714298f,
+    0.333333343f, 0.380952388f, 0.428571433f, 0.476190478f, 0.523809552f, 0.571428597f,
+    0.619047642f, 0.666666687f, 0.714285731f, 0.761904776f, 0.809523821f, 0.857142866f,
+    0.904761910f, 0.952380955f, 1.00000000f, 0.958333313f, 0.916666687f, 0.875000000f,
+    0.833333313f, 0.791666687f, 0.750000000f, 0.708333313f, 0.666666687f, 0.625000000f,
+    0.583333313f, 0.541666687f, 0.500000000f, 0.458333343f, 0.416666657f, 0.375000000f,
+    0.333333343f, 0.291666657f, 0.250000000f, 0.208333328f, 0.166666672f, 0.125000000f,
+    0.0833333358f, 0.0416666679f, 0.0416666679f, 0.0833333358f, 0.125000000f, 0.166666672f,
+    0.208333328f, 0.250000000f, 0.291666657f, 0.333333343f, 0.375000000f, 0.416666657f,
+    0.458333343f, 0.500000000f, 0.541666687f, 0.583333313f, 0.625000000f, 0.666666687f,
+    0.708333313f, 0.750000000f, 0.791666687f, 0.833333313f, 0.875000000f, 0.916666687f,
+    0.958333313f, 1.00000000f, 0.961538434f, 0.923076928f, 0.884615362f, 0.846153855f,
+    0.807692289f, 0.769230783f, 0.730769217f, 0.692307711f, 0.653846145f, 0.615384638f,
+    0.576923072f, 0.538461566f, 0.500000000f, 0.461538464f, 0.423076928f, 0.384615391f,
+    0.346153855f, 0.307692319f, 0.269230783f, 0.230769232f, 0.192307696f, 0.153846160f,
+    0.115384616f, 0.0769230798f, 0.0384615399f, 0.0384615399f, 0.0769230798f, 0.115384616f,
+    0.153846160f, 0.192307696f, 0.230769232f, 0.269230783f, 0.307692319f, 0.346153855f,
+    0.384615391f, 0.423076928f, 0.461538464f, 0.500000000f, 0.538461566f, 0.576923072f,
+    0.615384638f, 0.653846145f, 0.692307711f, 0.730769217f, 0.769230783f, 0.807692289f,
+    0.846153855f, 0.884615362f, 0.923076928f, 0.961538434f, 1.00000000f, 0.965517223f,
+    0.931034505f, 0.896551728f, 0.862068951f, 0.827586234f, 0.793103456f, 0.758620679f,
+    0.724137902f, 0.689655185f, 0.655172408f, 0.620689631f, 0.586206913f, 0.551724136f,
+    0.517241359f, 0.482758611f, 0.448275864f, 0.413793117f, 0.379310340f, 0.344827592f,
+    0.310344815f, 0.275862068f, 0.241379306f, 0.206896558f, 0.172413796f, 0.137931034f,
+    0.103448279f, 0.0689655170f, 0.0344827585f, 0.0344827585f, 0.0689655170f, 0.103448279f,
+    0.137931034f, 0.172413796f, 0.206896558f, 0.241379306f, 0.275862068f, 0.310344815f,
+    0.344827592f, 0.379310340f, 0.413793117f, 0.448275864f, 0.482758611f, 0.517241359f,
+    0.551724136f, 0.586206913f, 0.620689631f, 0.655172408f, 0.689655185f, 0.724137902f,
+    0.758620679f, 0.793103456f, 0.827586234f, 0.862068951f, 0.896551728f, 0.931034505f,
+    0.965517223f, 1.00000000f, 0.966666639f, 0.933333337f, 0.899999976f, 0.866666675f,
+    0.833333313f, 0.800000012f, 0.766666651f, 0.733333349f, 0.699999988f, 0.666666687f,
+    0.633333325f, 0.600000024f, 0.566666663f, 0.533333361f, 0.500000000f, 0.466666669f,
+    0.433333337f, 0.400000006f, 0.366666675f, 0.333333343f, 0.300000012f, 0.266666681f,
+    0.233333334f, 0.200000003f, 0.166666672f, 0.133333340f, 0.100000001f, 0.0666666701f,
+    0.0333333351f, 0.0333333351f, 0.0666666701f, 0.100000001f, 0.133333340f, 0.166666672f,
+    0.200000003f, 0.233333334f, 0.266666681f, 0.300000012f, 0.333333343f, 0.366666675f,
+    0.400000006f, 0.433333337f, 0.466666669f, 0.500000000f, 0.533333361f, 0.566666663f,
+    0.600000024f, 0.633333325f, 0.666666687f, 0.699999988f, 0.733333349f, 0.766666651f,
+    0.800000012f, 0.833333313f, 0.866666675f, 0.899999976f, 0.933333337f, 0.966666639f,
+    1.00000000f, 0.970588207f, 0.941176474f, 0.911764681f, 0.882352948f, 0.852941155f,
+    0.823529422f, 0.794117630f, 0.764705896f, 0.735294104f, 0.705882370f, 0.676470578f,
+    0.647058845f, 0.617647052f, 0.588235319f, 0.558823526f, 0.529411793f, 0.500000000f,
+    0.470588237f, 0.441176474f, 0.411764711f, 0.382352948f, 0.352941185f, 0.323529422f,
+    0.294117659f, 0.264705896f, 0.235294119f, 0.205882356f, 0.176470593f, 0.147058830f,
+    0.117647059f, 0.0882352963f, 0.0588235296f, 0.0294117648f, 0.0294117648f, 0.0588235296f,
+    0.0882352963f, 0.117647059f, 0.147058830f, 0.176470593f, 0.205882356f, 0.235294119f,
+    0.264705896f, 0.294117659f, 0.323529422f, 0.352941185f, 0.382352948f, 0.411764711f,
+    0.441176474f, 0.470588237f, 0.500000000f, 0.529411793f, 0.558823526f, 0.588235319f,
+    0.617647052f, 0.647058845f, 0.676470578f, 0.705882370f, 0.735294104f, 0.764705896f,
+    0.794117630f, 0.823529422f, 0.852941155f, 0.882352948f, 0.911764681f, 0.941176474f,
+    0.970588207f, 1.00000000f, 0.972972989f, 0.945945919f, 0.918918908f, 0.891891897f,
+    0.864864886f, 0.837837815f, 0.810810804f, 0.783783793f, 0.756756783f, 0.729729712f,
+    0.702702701f, 0.675675690f, 0.648648620f, 0.621621609f, 0.594594598f, 0.567567587f,
+    0.540540516f, 0.513513505f, 0.486486495f, 0.459459454f, 0.432432443f, 0.405405402f,
+    0.378378391f, 0.351351351f, 0.324324310f, 0.297297299f, 0.270270258f, 0.243243247f,
+    0.216216221f, 0.189189196f, 0.162162155f, 0.135135129f, 0.108108111f, 0.0810810775f,
+    0.0540540554f, 0.0270270277f, 0.0270270277f, 0.0540540554f, 0.0810810775f, 0.108108111f,
+    0.135135129f, 0.162162155f, 0.189189196f, 0.216216221f, 0.243243247f, 0.270270258f,
+    0.297297299f, 0.324324310f, 0.351351351f, 0.378378391f, 0.405405402f, 0.432432443f,
+    0.459459454f, 0.486486495f, 0.513513505f, 0.540540516f, 0.567567587f, 0.594594598f,
+    0.621621609f, 0.648648620f, 0.675675690f, 0.702702701f, 0.729729712f, 0.756756783f,
+    0.783783793f, 0.810810804f, 0.837837815f, 0.864864886f, 0.891891897f, 0.918918908f,
+    0.945945919f, 0.972972989f, 1.00000000f, 0.975000024f, 0.949999988f, 0.925000012f,
+    0.899999976f, 0.875000000f, 0.850000024f, 0.824999988f, 0.800000012f, 0.774999976f,
+    0.750000000f, 0.725000024f, 0.699999988f, 0.675000012f, 0.649999976f, 0.625000000f,
+    0.600000024f, 0.574999988f, 0.550000012f, 0.524999976f, 0.500000000f, 0.474999994f,
+    0.449999988f, 0.425000012f, 0.400000006f, 0.375000000f, 0.349999994f, 0.324999988f,
+    0.300000012f, 0.275000006f, 0.250000000f, 0.224999994f, 0.200000003f, 0.174999997f,
+    0.150000006f, 0.125000000f, 0.100000001f, 0.0750000030f, 0.0500000007f, 0.0250000004f,
+    0.0250000004f, 0.0500000007f, 0.0750000030f, 0.100000001f, 0.125000000f, 0.150000006f,
+    0.174999997f, 0.200000003f, 0.224999994f, 0.250000000f, 0.275000006f, 0.300000012f,
+    0.324999988f, 0.349999994f, 0.375000000f, 0.400000006f, 0.425000012f, 0.449999988f,
+    0.474999994f, 0.500000000f, 0.524999976f, 0.550000012f, 0.574999988f, 0.600000024f,
+    0.625000000f, 0.649999976f, 0.675000012f, 0.699999988f, 0.725000024f, 0.750000000f,
+    0.774999976f, 0.800000012f, 0.824999988f, 0.850000024f, 0.875000000f, 0.899999976f,
+    0.925000012f, 0.949999988f, 0.975000024f, 1.00000000f, 0.976744175f, 0.953488350f,
+    0.930232584f, 0.906976759f, 0.883720934f, 0.860465109f, 0.837209284f, 0.813953459f,
+    0.790697694f, 0.767441869f, 0.744186044f, 0.720930219f, 0.697674394f, 0.674418628f,
+    0.651162803f, 0.627906978f, 0.604651153f, 0.581395328f, 0.558139563f, 0.534883738f,
+    0.511627913f, 0.488372087f, 0.465116292f, 0.441860467f, 0.418604642f, 0.395348847f,
+    0.372093022f, 0.348837197f, 0.325581402f, 0.302325577f, 0.279069781f, 0.255813956f,
+    0.232558146f, 0.209302321f, 0.186046511f, 0.162790701f, 0.139534891f, 0.116279073f,
+    0.0930232555f, 0.0697674453f, 0.0465116277f, 0.0232558139f,
+};
+
+constexpr BakedMelTable kMelTables[] = {
+    {44100.0000f, 1024, 40, 20.0000000f, 22050.0000f, kMel44100Spans, kMel44100Weights, 941},
+    {48000.0000f, 1024, 40, 20.0000000f, 24000.0000f, kMel48000Spans, kMel48000Weights, 940},
+};
+
+constexpr int kDctInputs = 40;
+constexpr int kDctCoeffs = 13;
+constexpr float kDctBasis[520] = {
+    0.158113882f, 0.158113882f, 0.158113882f, 0.158113882f, 0.158113882f, 0.158113882f,
+    0.158113882f, 0.158113882f, 0.158113882f, 0.158113882f, 0.158113882f, 0.158113882f,
+    0.158113882f, 0.158113882f, 0.158113882f, 0.158113882f, 0.158113882f, 0.158113882f,
+    0.158113882f, 0.158113882f, 0.158113882f, 0.158113882f, 0.158113882f, 0.158113882f,
+    0.158113882f, 0.158113882f, 0.158113882f, 0.158113882f, 0.158113882f, 0.158113882f,
+    0.158113882f, 0.158113882f, 0.158113882f, 0.158113882f, 0.158113882f, 0.158113882f,
+    0.158113882f, 0.158113882f, 0.158113882f, 0.158113882f, 0.223434404f, 0.222056851f,
+    0.219310254f, 0.215211540f, 0.209785953f, 0.203066990f, 0.195096031f, 0.185922250f,
+    0.175602198f, 0.164199501f, 0.151784465f, 0.138433620f, 0.124229282f, 0.109259032f,
+    0.0936151668f, 0.0773941278f, 0.0606959313f, 0.0436235219f, 0.0262821615f, 0.00877876207f,
+    -0.00877876207f, -0.0262821615f, -0.0436235219f, -0.0606959313f, -0.0773941278f, -0.0936151668f,
+    -0.109259032f, -0.124229282f, -0.138433620f, -0.151784465f, -0.164199501f, -0.175602198f,
+    -0.185922250f, -0.195096031f, -0.203066990f, -0.209785953f, -0.215211540f, -0.219310254f,
+    -0.222056851f, -0.223434404f, 0.222917497f, 0.217428520f, 0.206585750f, 0.190656140f,
+    0.170031950f, 0.145220995f, 0.116834231f, 0.0855706185f, 0.0521999709f, 0.0175439864f,
+    -0.0175439864f, -0.0521999709f, -0.0855706185f, -0.116834231f, -0.145220995f, -0.170031950f,
+    -0.190656140f, -0.206585750f, -0.217428520f, -0.222917497f, -0.222917497f, -0.217428520f,
+    -0.206585750f, -0.190656140f, -0.170031950f, -0.145220995f, -0.116834231f, -0.0855706185f,
+    -0.0521999709f, -0.0175439864f, 0.0175439864f, 0.0521999709f, 0.0855706185f, 0.116834231f,
+    0.145220995f, 0.170031950f, 0.190656140f, 0.206585750f, 0.217428520f, 0.222917497f,
+    0.222056851f, 0.209785953f, 0.185922250f, 0.151784465f, 0.109259032f, 0.0606959313f,
+    0.00877876207f, -0.0436235219f, -0.0936151668f, -0.138433620f, -0.175602198f, -0.203066990f,
+    -0.219310254f, -0.223434404f, -0.215211540f, -0.195096031f, -0.164199501f, -0.124229282f,
+    -0.0773941278f, -0.0262821615f, 0.0262821615f, 0.0773941278f, 0.124229282f, 0.164199501f,
+    0.195096031f, 0.215211540f, 0.223434404f, 0.219310254f, 0.203066990f, 0.175602198f,
+    0.138433620f, 0.0936151668f, 0.0436235219f, -0.00877876207f, -0.0606959313f, -0.109259032f,
+    -0.151784465f, -0.185922250f, -0.209785953f, -0.222056851f, 0.220853820f, 0.199235111f,
+    0.158113882f, 0.101515360f, 0.0349798091f, -0.0349798091f, -0.101515360f, -0.158113882f,
+    -0.199235111f, -0.220853820f, -0.220853820f, -0.199235111f, -0.158113882f, -0.101515360f,
+    -0.0349798091f, 0.0349798091f, 0.101515360f, 0.158113882f, 0.199235111f, 0.220853820f,
+    0.220853820f, 0.199235111f, 0.158113882f, 0.101515360f, 0.0349798091f, -0.0349798091f,
+    -0.101515360f, -0.158113882f, -0.199235111f, -0.220853820f, -0.220853820f, -0.199235111f,
+    -0.158113882f, -0.101515360f, -0.0349798091f, 0.0349798091f, 0.101515360f, 0.158113882f,
+    0.199235111f, 0.220853820f, 0.219310254f, 0.185922250f, 0.124229282f, 0.0436235219f,
+    -0.0436235219f, -0.124229282f, -0.185922250f, -0.219310254f, -0.219310254f, -0.185922250f,
+    -0.124229282f, -0.0436235219f, 0.0436235219f, 0.124229282f, 0.185922250f, 0.219310254f,
+    0.219310254f, 0.185922250f, 0.124229282f, 0.0436235219f, -0.0436235219f, -0.124229282f,
+    -0.185922250f, -0.219310254f, -0.219310254f, -0.185922250f, -0.124229282f, -0.0436235219f,
+    0.0436235219f, 0.124229282f, 0.185922250f, 0.219310254f, 0.219310254f, 0.185922250f,
+    0.124229282f, 0.0436235219f, -0.0436235219f, -0.124229282f, -0.185922250f, -0.219310254f,
+    0.217428520f, 0.170031950f, 0.0855706185f, -0.0175439864f, -0.116834231f, -0.190656140f,
+    -0.222917497f, -0.206585750f, -0.145220995f, -0.0521999709f, 0.0521999709f, 0.145220995f,
+    0.206585750f, 0.222917497f, 0.190656140f, 0.116834231f, 0.0175439864f, -0.0855706185f,
+    -0.170031950f, -0.217428520f, -0.217428520f, -0.170031950f, -0.0855706185f, 0.0175439864f,
+    0.116834231f, 0.190656140f, 0.222917497f, 0.206585750f, 0.145220995f, 0.0521999709f,
+    -0.0521999709f, -0.145220995f, -0.206585750f, -0.222917497f, -0.190656140f, -0.116834231f,
+    -0.0175439864f, 0.0855706185f, 0.170031950f, 0.217428520f, 0.215211540f, 0.151784465f,
+    0.0436235219f, -0.0773941278f, -0.175602198f, -0.222056851f, -0.203066990f, -0.124229282f,
+    -0.00877876207f, 0.109259032f, 0.195096031f, 0.223434404f, 0.185922250f, 0.0936151668f,
+    -0.0262821615f, -0.138433620f, -0.209785953f, -0.219310254f, -0.164199501f, -0.0606959313f,
+    0.0606959313f, 0.164199501f, 0.219310254f, 0.209785953f, 0.138433620f, 0.0262821615f,
+    -0.0936151668f, -0.185922250f, -0.223434404f, -0.195096031f, -0.109259032f, 0.00877876207f,
+    0.124229282f, 0.203066990f, 0.222056851f, 0.175602198f, 0.0773941278f, -0.0436235219f,
+    -0.151784465f, -0.215211540f, 0.212662697f, 0.131432772f, 1.36919675e-17f, -0.131432772f,
+    -0.212662697f, -0.212662697f, -0.131432772f, -4.10759032e-17f, 0.131432772f, 0.212662697f,
+    0.212662697f, 0.131432772f, 6.84598365e-17f, -0.131432772f, -0.212662697f, -0.212662697f,
+    -0.131432772f, -9.58437698e-17f, 0.131432772f, 0.212662697f, 0.212662697f, 0.131432772f,
+    1.23227703e-16f, -0.131432772f, -0.212662697f, -0.212662697f, -0.131432772f, 2.46593817e-16f,
+    0.131432772f, 0.212662697f, 0.212662697f, 0.131432772f, 5.75201016e-16f, -0.131432772f,
+    -0.212662697f, -0.212662697f, -0.131432772f, -6.02584956e-16f, 0.131432772f, 0.212662697f,
+    0.209785953f, 0.109259032f, -0.0436235219f, -0.175602198f, -0.223434404f, -0.164199501f,
+    -0.0262821615f, 0.124229282f, 0.215211540f, 0.203066990f, 0.0936151668f, -0.0606959313f,
+    -0.185922250f, -0.222056851f, -0.151784465f, -0.00877876207f, 0.138433620f, 0.219310254f,
+    0.195096031f, 0.0773941278f, -0.0773941278f, -0.195096031f, -0.219310254f, -0.138433620f,
+    0.00877876207f, 0.151784465f, 0.222056851f, 0.185922250f, 0.0606959313f, -0.0936151668f,
+    -0.203066990f, -0.215211540f, -0.124229282f, 0.0262821615f, 0.164199501f, 0.223434404f,
+    0.175602198f, 0.0436235219f, -0.109259032f, -0.209785953f, 0.206585750f, 0.0855706185f,
+    -0.0855706185f, -0.206585750f, -0.206585750f, -0.0855706185f, 0.0855706185f, 0.206585750f,
+    0.206585750f, 0.0855706185f, -0.0855706185f, -0.206585750f, -0.206585750f, -0.0855706185f,
+    0.0855706185f, 0.206585750f, 0.206585750f, 0.0855706185f, -0.0855706185f, -0.206585750f,
+    -0.206585750f, -0.0855706185f, 0.0855706185f, 0.206585750f, 0.206585750f, 0.0855706185f,
+    -0.0855706185f, -0.206585750f, -0.206585750f, -0.0855706185f, 0.0855706185f, 0.206585750f,
+    0.206585750f, 0.0855706185f, -0.0855706185f, -0.206585750f, -0.206585750f, -0.0855706185f,
+    0.0855706185f, 0.206585750f, 0.203066990f, 0.0606959313f, -0.124229282f, -0.222056851f,
+    -0.164199501f, 0.00877876207f, 0.175602198f, 0.219310254f, 0.109259032f, -0.0773941278f,
+    -0.209785953f, -0.195096031f, -0.0436235219f, 0.138433620f, 0.223434404f, 0.151784465f,
+    -0.0262821615f, -0.185922250f, -0.215211540f, -0.0936151668f, 0.0936151668f, 0.215211540f,
+    0.185922250f, 0.0262821615f, -0.151784465f, -0.223434404f, -0.138433620f, 0.0436235219f,
+    0.195096031f, 0.209785953f, 0.0773941278f, -0.109259032f, -0.219310254f, -0.175602198f,
+    -0.00877876207f, 0.164199501f, 0.222056851f, 0.124229282f, -0.0606959313f, -0.203066990f,
+    0.199235111f, 0.0349798091f, -0.158113882f, -0.220853820f, -0.101515360f, 0.101515360f,
+    0.220853820f, 0.158113882f, -0.0349798091f, -0.199235111f, -0.199235111f, -0.0349798091f,
+    0.158113882f, 0.220853820f, 0.101515360f, -0.101515360f, -0.220853820f, -0.158113882f,
+    0.0349798091f, 0.199235111f, 0.199235111f, 0.0349798091f, -0.158113882f, -0.220853820f,
+    -0.101515360f, 0.101515360f, 0.220853820f, 0.158113882f, -0.0349798091f, -0.199235111f,
+    -0.199235111f, -0.0349798091f, 0.158113882f, 0.220853820f, 0.101515360f, -0.101515360f,
+    -0.220853820f, -0.158113882f, 0.0349798091f, 0.199235111f,
+};
+
+}  // namespace default_tables
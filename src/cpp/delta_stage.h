@@ -0,0 +1,139 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+#include "processor_config.h"
+
+// Regression deltas over a +-N frame window:
+//   d[t] = sum_{n=1..N} n * (c[t+n] - c[t-n]) / (2 * sum_{n=1..N} n²)
+// The same regression applied to the deltas gives the delta-deltas.
+//
+// Streaming frames only know the past, so push() keeps a circular history of
+// the last 2N+1 statics (and deltas) and emits frame t - order*N once frame t
+// arrives: one output row per input row, delayed by order*N frames. Each push
+// costs O(N * numCoeffs) with N a small constant; nothing is rescanned. The
+// history starts out filled with the first frame, so the first order*N rows
+// are start-up padding.
+class DeltaStage {
+public:
+    explicit DeltaStage(const ProcessorConfig& config)
+        : numCoeffs(config.numCoeffs),
+          order(config.deltaOrder),
+          window(config.deltaWindow),
+          span(2 * config.deltaWindow + 1),
+          statics(static_cast<size_t>(span) * config.numCoeffs, 0.0f),
+          deltas(static_cast<size_t>(span) * config.numCoeffs, 0.0f) {}
+
+    int getOrder() const { return order; }
+    int getDelay() const { return order * window; }
+
+    void reset() {
+        framesSeen = 0;
+        pos = 0;
+    }
+
+    // Reads numCoeffs statics from in, writes numCoeffs * (1 + order) values
+    // (statics, deltas, delta-deltas of the delayed frame) to out. in may be
+    // the first numCoeffs floats of out.
+    void push(const float* in, float* out) {
+        if (order == 0) {
+            std::copy(in, in + numCoeffs, out);
+            return;
+        }
+
+        // Statics ring: slot pos gets c[t]
+        if (framesSeen == 0) {
+            for (int s = 0; s < span; s++) std::copy(in, in + numCoeffs, slot(statics, s));
+        } else {
+            std::copy(in, in + numCoeffs, slot(statics, pos));
+        }
+
+        // d[t-N] is centred on the middle of the statics ring
+        float* d = slot(deltas, pos);
+        regression(statics, pos, d);
+        if (framesSeen == 0) {
+            for (int s = 0; s < span; s++) {
+                if (s != pos) std::copy(d, d + numCoeffs, slot(deltas, s));
+            }
+        }
+
+        // Oldest needed frame: t-N for order 1, t-2N for order 2
+        int delay = getDelay();
+        const float* c = slot(statics, wrap(pos - delay));
+        std::copy(c, c + numCoeffs, out);
+        if (order == 1) {
+            std::copy(d, d + numCoeffs, out + numCoeffs);
+        } else {
+            const float* dDelayed = slot(deltas, wrap(pos - window));
+            std::copy(dDelayed, dDelayed + numCoeffs, out + numCoeffs);
+            regression(deltas, pos, out + 2 * numCoeffs);
+        }
+
+        pos = wrap(pos + 1);
+        framesSeen++;
+    }
+
+    // Offline version for a whole numFrames x width matrix whose first
+    // numCoeffs columns are statics: fills the delta columns aligned with
+    // their frame, replicating the first/last frame past the edges. Rows are
+    // rowStride floats apart (0 means outputWidth(config)).
+    static void applyAligned(const ProcessorConfig& config, float* frames, int numFrames, int rowStride = 0) {
+        int numCoeffs = config.numCoeffs;
+        int width = rowStride > 0 ? rowStride : outputWidth(config);
+        for (int o = 1; o <= config.deltaOrder; o++) {
+            int src = (o - 1) * numCoeffs;
+            int dst = o * numCoeffs;
+            float norm = normalization(config.deltaWindow);
+            for (int f = 0; f < numFrames; f++) {
+                float* out = frames + static_cast<size_t>(f) * width + dst;
+                std::fill(out, out + numCoeffs, 0.0f);
+                for (int n = 1; n <= config.deltaWindow; n++) {
+                    const float* next = frames + static_cast<size_t>(std::min(f + n, numFrames - 1)) * width + src;
+                    const float* prev = frames + static_cast<size_t>(std::max(f - n, 0)) * width + src;
+                    for (int k = 0; k < numCoeffs; k++) {
+                        out[k] += n * (next[k] - prev[k]);
+                    }
+                }
+                for (int k = 0; k < numCoeffs; k++) {
+                    out[k] *= norm;
+                }
+            }
+        }
+    }
+
+private:
+    int numCoeffs;
+    int order;
+    int window;  // N
+    int span;    // 2N + 1 ring slots
+    std::vector<float> statics;
+    std::vector<float> deltas;
+    int pos = 0;
+    int framesSeen = 0;
+
+    static float normalization(int n) {
+        // 1 / (2 * sum n²) = 3 / (N (N+1) (2N+1))
+        return 3.0f / static_cast<float>(n * (n + 1) * (2 * n + 1));
+    }
+
+    int wrap(int s) const { return ((s % span) + span) % span; }
+    float* slot(std::vector<float>& ring, int s) { return ring.data() + static_cast<size_t>(s) * numCoeffs; }
+
+    // Regression centred N slots before newest: newest is ring[newest]
+    void regression(std::vector<float>& ring, int newest, float* out) {
+        float norm = normalization(window);
+        std::fill(out, out + numCoeffs, 0.0f);
+        int centre = newest - window;
+        for (int n = 1; n <= window; n++) {
+            const float* next = slot(ring, wrap(centre + n));
+            const float* prev = slot(ring, wrap(centre - n));
+            for (int k = 0; k < numCoeffs; k++) {
+                out[k] += n * (next[k] - prev[k]);
+            }
+        }
+        for (int k = 0; k < numCoeffs; k++) {
+            out[k] *= norm;
+        }
+    }
+};
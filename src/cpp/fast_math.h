@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+// Precision policy for the per-frame transcendental calls.
+// Exact goes through libm and is bit-compatible with earlier builds; Fast
+// swaps in the polynomial below. Selected at compile time so the exact build
+// carries no extra branch: define SIGNAL_PROCESSOR_FAST_MATH to get Fast.
+//
+// Only the log of the mel energies runs per frame. Every cosine and sine of
+// the pipeline (window, twiddles, filterbank, DCT basis) is evaluated once
+// into a table when the processor is built, so there is no fast cosine.
+enum class Precision {
+    Exact,
+    Fast,
+};
+
+#ifdef SIGNAL_PROCESSOR_FAST_MATH
+constexpr Precision kPrecision = Precision::Fast;
+#else
+constexpr Precision kPrecision = Precision::Exact;
+#endif
+
+namespace fast_math {
+
+constexpr float kLn2 = 0.693147180559945f;
+constexpr uint32_t kSqrtHalfBits = 0x3f3504f3;  // bit pattern of sqrt(0.5)
+
+// Natural log for finite, positive, normal x.
+// x = 2^e * m with m in [sqrt(0.5), sqrt(2)), found by integer arithmetic on
+// the bit pattern, then ln(m) = 2 atanh(t) with t = (m-1)/(m+1), |t| < 0.1716,
+// from the series 2 (t + t³/3 + t⁵/5 + t⁷/7).
+// Over every float in [1e-10, 1e10] the error is at most 3.3 ulp of the
+// result: below 1e-7 absolute for |ln x| < 1 and 2.1e-6 absolute at the
+// 1e-10 floor, where libm's rounded float log is off by up to 9.6e-7.
+inline float log(float x) {
+    uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    // Arithmetic shift: the exponent goes negative below sqrt(0.5)
+    int32_t e = static_cast<int32_t>(bits - kSqrtHalfBits) >> 23;
+    uint32_t mantissaBits = bits - (static_cast<uint32_t>(e) << 23);
+    float m;
+    std::memcpy(&m, &mantissaBits, sizeof(m));
+
+    float t = (m - 1.0f) / (m + 1.0f);
+    float t2 = t * t;
+    float lnM = t * (2.0f + t2 * (2.0f / 3.0f + t2 * (2.0f / 5.0f + t2 * (2.0f / 7.0f))));
+    return static_cast<float>(e) * kLn2 + lnM;
+}
+
+}  // namespace fast_math
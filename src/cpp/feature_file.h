@@ -0,0 +1,573 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "processor_config.h"
+
+// Binary feature file, little-endian throughout. Version 2 layout:
+//
+//   Header        64 bytes
+//   Blocks        framesPerBlock rows each (the last may be shorter), every
+//                 row width values in the file encoding. Uint8 blocks start
+//                 with their own mapping, width float scales then width float
+//                 offsets: quantization is per block, not per stream, since a
+//                 streaming writer never sees the whole range up front.
+//   Index         numBlocks x {uint64 firstFrame, uint64 byteOffset}, first
+//                 frames ascending from 0
+//
+// The header's frame count and index offset are patched when the writer
+// finishes, so any frame can be reached by reading the header and the index
+// and then one block.
+namespace feature_file {
+
+constexpr char kMagic[4] = {'M', 'F', 'C', 'C'};
+constexpr uint32_t kVersion = 2;
+constexpr uint32_t kDefaultFramesPerBlock = 1024;
+// Keeps row sizes and block frame counts well inside int and size_t
+constexpr uint32_t kMaxWidth = 1u << 16;
+
+enum class Encoding : uint32_t {
+    Float32 = 0,
+    Float16 = 1,  // IEEE 754 half, round to nearest even
+    Uint8 = 2,    // value = offset[column] + code * scale[column], mapping stored per block
+};
+
+inline size_t bytesPerValue(Encoding encoding) {
+    switch (encoding) {
+        case Encoding::Float16: return 2;
+        case Encoding::Uint8:   return 1;
+        default:                return 4;
+    }
+}
+
+struct Header {
+    char magic[4];
+    uint32_t version;
+    uint32_t encoding;        // Encoding
+    uint32_t width;           // values per frame, numCoeffs * (1 + deltaOrder)
+    uint32_t numCoeffs;
+    uint32_t deltaOrder;
+    float sampleRate;
+    uint32_t frameLength;
+    uint32_t hopLength;
+    uint32_t framesPerBlock;
+    uint64_t numFrames;
+    uint64_t indexOffset;     // byte offset of the block index
+    uint32_t numBlocks;
+    uint32_t reserved;
+};
+static_assert(sizeof(Header) == 64, "feature file header must stay 64 bytes");
+
+struct IndexEntry {
+    uint64_t firstFrame;
+    uint64_t byteOffset;
+};
+static_assert(sizeof(IndexEntry) == 16, "index entries must stay 16 bytes");
+
+// Per-column mapping of a Uint8 block
+struct Quantization {
+    std::vector<float> scale;
+    std::vector<float> offset;
+};
+
+inline Header makeHeader(const ProcessorConfig& config, Encoding encoding,
+                         uint32_t framesPerBlock = kDefaultFramesPerBlock) {
+    Header header = {};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.encoding = static_cast<uint32_t>(encoding);
+    header.width = static_cast<uint32_t>(outputWidth(config));
+    header.numCoeffs = static_cast<uint32_t>(config.numCoeffs);
+    header.deltaOrder = static_cast<uint32_t>(config.deltaOrder);
+    header.sampleRate = config.sampleRate;
+    header.frameLength = static_cast<uint32_t>(config.frameLength);
+    header.hopLength = static_cast<uint32_t>(config.hopLength);
+    header.framesPerBlock = std::max<uint32_t>(1, framesPerBlock);
+    return header;
+}
+
+inline Encoding encodingOf(const Header& header) { return static_cast<Encoding>(header.encoding); }
+
+inline size_t rowBytes(const Header& header) {
+    return header.width * bytesPerValue(encodingOf(header));
+}
+
+// Mapping stored in front of each block's rows (Uint8 only)
+inline size_t blockPrefixBytes(const Header& header) {
+    return encodingOf(header) == Encoding::Uint8 ? 2 * sizeof(float) * header.width : 0;
+}
+
+inline size_t blockBytes(const Header& header, int numFrames) {
+    return blockPrefixBytes(header) + static_cast<size_t>(numFrames) * rowBytes(header);
+}
+
+// Reads the header from the start of a file
+inline bool parseHeader(const uint8_t* data, size_t size, Header& header) {
+    if (size < sizeof(Header) || std::memcmp(data, kMagic, sizeof(kMagic)) != 0) return false;
+    std::memcpy(&header, data, sizeof(Header));
+    return header.version == kVersion && header.encoding <= 2 && header.width > 0 &&
+           header.width <= kMaxWidth && header.framesPerBlock > 0 &&
+           header.framesPerBlock <= static_cast<uint32_t>(std::numeric_limits<int>::max());
+}
+
+// float32 -> half, round to nearest even; overflow goes to infinity and
+// values below the half subnormal range to zero
+inline uint16_t floatToHalf(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    uint32_t sign = (bits >> 16) & 0x8000u;
+    uint32_t magnitude = bits & 0x7fffffffu;
+
+    if (magnitude >= 0x7f800000u) {
+        // Inf stays Inf, NaN keeps a quiet payload bit
+        return static_cast<uint16_t>(sign | 0x7c00u | (magnitude > 0x7f800000u ? 0x200u : 0u));
+    }
+    if (magnitude >= 0x477ff000u) {
+        return static_cast<uint16_t>(sign | 0x7c00u);  // rounds past the largest half
+    }
+    if (magnitude < 0x38800000u) {
+        // Half subnormal: shift the full mantissa into place with rounding
+        if (magnitude < 0x33000000u) return static_cast<uint16_t>(sign);
+        uint32_t mantissa = (magnitude & 0x7fffffu) | 0x800000u;
+        int shift = 126 - static_cast<int>(magnitude >> 23);
+        uint32_t half = mantissa >> shift;
+        uint32_t rest = mantissa & ((1u << shift) - 1);
+        uint32_t halfway = 1u << (shift - 1);
+        if (rest > halfway || (rest == halfway && (half & 1u))) half++;
+        return static_cast<uint16_t>(sign | half);
+    }
+    // Normal: rebias the exponent and round the 13 dropped mantissa bits
+    uint32_t half = (magnitude - 0x38000000u) >> 13;
+    uint32_t rest = magnitude & 0x1fffu;
+    if (rest > 0x1000u || (rest == 0x1000u && (half & 1u))) half++;
+    return static_cast<uint16_t>(sign | half);
+}
+
+inline float halfToFloat(uint16_t half) {
+    uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+    uint32_t exponent = (half >> 10) & 0x1fu;
+    uint32_t mantissa = half & 0x3ffu;
+    uint32_t bits;
+    if (exponent == 0x1f) {
+        bits = sign | 0x7f800000u | (mantissa << 13);
+    } else if (exponent != 0) {
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    } else if (mantissa == 0) {
+        bits = sign;
+    } else {
+        // Subnormal half: normalize into a float
+        exponent = 113;
+        while ((mantissa & 0x400u) == 0) {
+            mantissa <<= 1;
+            exponent--;
+        }
+        bits = sign | (exponent << 23) | ((mantissa & 0x3ffu) << 13);
+    }
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Uint8 mapping spanning each column's range over rows
+inline Quantization fitQuantization(const float* rows, int numRows, int width) {
+    Quantization q;
+    q.scale.assign(width, 1.0f);
+    q.offset.assign(width, 0.0f);
+    for (int k = 0; k < width; k++) {
+        float lo = 0.0f;
+        float hi = 0.0f;
+        for (int f = 0; f < numRows; f++) {
+            float v = rows[static_cast<size_t>(f) * width + k];
+            lo = f == 0 ? v : std::min(lo, v);
+            hi = f == 0 ? v : std::max(hi, v);
+        }
+        q.offset[k] = lo;
+        q.scale[k] = hi > lo ? (hi - lo) / 255.0f : 1.0f;
+    }
+    return q;
+}
+
+// Encodes numRows rows of header.width floats into rowBytes(header) bytes each
+inline void encodeRows(const Header& header, const Quantization& q, const float* rows, int numRows,
+                       uint8_t* out) {
+    size_t count = static_cast<size_t>(numRows) * header.width;
+    switch (encodingOf(header)) {
+        case Encoding::Float32:
+            std::memcpy(out, rows, count * sizeof(float));
+            break;
+        case Encoding::Float16:
+            for (size_t i = 0; i < count; i++) {
+                uint16_t half = floatToHalf(rows[i]);
+                std::memcpy(out + 2 * i, &half, sizeof(half));
+            }
+            break;
+        case Encoding::Uint8:
+            for (size_t i = 0; i < count; i++) {
+                int k = static_cast<int>(i % header.width);
+                float code = (rows[i] - q.offset[k]) / q.scale[k] + 0.5f;
+                out[i] = static_cast<uint8_t>(std::min(std::max(code, 0.0f), 255.0f));
+            }
+            break;
+    }
+}
+
+inline void decodeRows(const Header& header, const Quantization& q, const uint8_t* in, int numRows,
+                       float* rows) {
+    size_t count = static_cast<size_t>(numRows) * header.width;
+    switch (encodingOf(header)) {
+        case Encoding::Float32:
+            std::memcpy(rows, in, count * sizeof(float));
+            break;
+        case Encoding::Float16:
+            for (size_t i = 0; i < count; i++) {
+                uint16_t half;
+                std::memcpy(&half, in + 2 * i, sizeof(half));
+                rows[i] = halfToFloat(half);
+            }
+            break;
+        case Encoding::Uint8:
+            for (size_t i = 0; i < count; i++) {
+                int k = static_cast<int>(i % header.width);
+                rows[i] = q.offset[k] + in[i] * q.scale[k];
+            }
+            break;
+    }
+}
+
+// Block-writing part of the format; subclasses decide where the bytes go.
+// Rows are buffered up to framesPerBlock and written one block at a time.
+// Uint8 blocks get a mapping fitted to their own rows unless a fixed one is
+// set with setQuantization().
+class Writer {
+public:
+    virtual ~Writer() = default;
+
+    const Header& getHeader() const { return header; }
+
+    // Fixed per-column Uint8 mapping for every block, e.g. a display range
+    void setQuantization(const Quantization& mapping) {
+        quantization = mapping;
+        fixedQuantization = true;
+    }
+
+    bool write(const float* rows, int numRows) {
+        size_t width = header.width;
+        while (numRows > 0) {
+            int room = static_cast<int>(header.framesPerBlock) - pendingRows;
+            int take = std::min(room, numRows);
+            pending.insert(pending.end(), rows, rows + static_cast<size_t>(take) * width);
+            pendingRows += take;
+            rows += static_cast<size_t>(take) * width;
+            numRows -= take;
+            if (pendingRows == static_cast<int>(header.framesPerBlock) && !flushBlock()) return false;
+        }
+        return true;
+    }
+
+    // Writes the last block, the index and the final header
+    bool finish() {
+        if (pendingRows > 0 && !flushBlock()) return false;
+        header.indexOffset = position;
+        header.numBlocks = static_cast<uint32_t>(index.size());
+        if (!emit(index.data(), index.size() * sizeof(IndexEntry))) return false;
+        return rewriteHeader(header);
+    }
+
+protected:
+    Header header = {};
+
+    // Starts the file; subclasses call this once their output is ready
+    bool begin(const Header& fileHeader) {
+        header = fileHeader;
+        header.version = kVersion;
+        header.numFrames = 0;
+        header.indexOffset = 0;
+        header.numBlocks = 0;
+        position = 0;
+        return emit(&header, sizeof(header));
+    }
+
+    virtual bool emitBytes(const void* bytes, size_t size) = 0;
+    // Overwrites the first sizeof(Header) bytes
+    virtual bool rewriteHeader(const Header& finalHeader) = 0;
+
+private:
+    Quantization quantization;
+    bool fixedQuantization = false;
+    std::vector<float> pending;    // rows of the current block
+    int pendingRows = 0;
+    std::vector<uint8_t> encoded;  // one encoded block
+    std::vector<IndexEntry> index;
+    uint64_t position = 0;
+
+    bool emit(const void* bytes, size_t size) {
+        position += size;
+        return size == 0 || emitBytes(bytes, size);
+    }
+
+    bool flushBlock() {
+        index.push_back({header.numFrames, position});
+        if (encodingOf(header) == Encoding::Uint8) {
+            if (!fixedQuantization || quantization.scale.size() != header.width) {
+                quantization = fitQuantization(pending.data(), pendingRows, static_cast<int>(header.width));
+            }
+            if (!emit(quantization.scale.data(), header.width * sizeof(float)) ||
+                !emit(quantization.offset.data(), header.width * sizeof(float))) {
+                return false;
+            }
+        }
+        encoded.resize(static_cast<size_t>(pendingRows) * rowBytes(header));
+        encodeRows(header, quantization, pending.data(), pendingRows, encoded.data());
+        header.numFrames += static_cast<uint64_t>(pendingRows);
+        pending.clear();
+        pendingRows = 0;
+        return emit(encoded.data(), encoded.size());
+    }
+};
+
+// Streams a feature file to disk; the output must be seekable for the final
+// header
+class FileWriter : public Writer {
+public:
+    ~FileWriter() override {
+        if (file) std::fclose(file);
+    }
+
+    bool open(const char* path, const Header& fileHeader) {
+        file = std::fopen(path, "wb");
+        return file && begin(fileHeader);
+    }
+
+    // finish() and close; false if anything failed to write
+    bool close() {
+        bool ok = finish();
+        ok = std::fclose(file) == 0 && ok;
+        file = nullptr;
+        return ok;
+    }
+
+protected:
+    bool emitBytes(const void* bytes, size_t size) override {
+        return std::fwrite(bytes, 1, size, file) == size;
+    }
+
+    bool rewriteHeader(const Header& finalHeader) override {
+        return std::fseek(file, 0, SEEK_SET) == 0 &&
+               std::fwrite(&finalHeader, sizeof(finalHeader), 1, file) == 1;
+    }
+
+private:
+    FILE* file = nullptr;
+};
+
+// Builds a feature file in memory (used by the WASM bindings)
+class BufferWriter : public Writer {
+public:
+    explicit BufferWriter(const Header& fileHeader) { begin(fileHeader); }
+
+    const std::vector<uint8_t>& getBytes() const { return bytes; }
+
+protected:
+    bool emitBytes(const void* data, size_t size) override {
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+        bytes.insert(bytes.end(), p, p + size);
+        return true;
+    }
+
+    bool rewriteHeader(const Header& finalHeader) override {
+        std::memcpy(bytes.data(), &finalHeader, sizeof(finalHeader));
+        return true;
+    }
+
+private:
+    std::vector<uint8_t> bytes;
+};
+
+// Random access over a feature file. The caller supplies the header and
+// index bytes through load(); blocks are then decoded from wherever the
+// caller keeps them (a memory buffer or a file read), located with
+// getBlockOffset() and sized with blockBytes().
+class Reader {
+public:
+    // Parses the header in [data, data + size) and the index in
+    // [indexData, indexData + indexSize). Both may point into one buffer
+    // holding the whole file. Fails unless the index covers frames
+    // 0..numFrames-1 in ascending blocks of 1..framesPerBlock frames, so the
+    // lookups below always land in a block.
+    bool load(const uint8_t* data, size_t size, const uint8_t* indexData, size_t indexSize) {
+        index.clear();
+        if (!parseHeader(data, size, header)) return false;
+        if (header.numBlocks > indexSize / sizeof(IndexEntry)) return false;
+        index.resize(header.numBlocks);
+        if (!index.empty()) std::memcpy(index.data(), indexData, index.size() * sizeof(IndexEntry));
+        if (!validIndex()) {
+            index.clear();
+            return false;
+        }
+        return true;
+    }
+
+    const Header& getHeader() const { return header; }
+    int getNumBlocks() const { return static_cast<int>(index.size()); }
+    uint64_t getBlockOffset(int block) const { return index[block].byteOffset; }
+    int getBlockFrames(int block) const {
+        uint64_t end = block + 1 < getNumBlocks() ? index[block + 1].firstFrame : header.numFrames;
+        return static_cast<int>(end - index[block].firstFrame);
+    }
+    uint64_t getBlockFirstFrame(int block) const { return index[block].firstFrame; }
+
+    // Whether the bytes of block lie within the first fileSize bytes,
+    // counted in 64 bits so a hostile header cannot wrap a 32-bit size_t
+    bool blockFits(int block, uint64_t fileSize) const {
+        uint64_t offset = index[block].byteOffset;
+        uint64_t length = blockPrefixBytes(header) +
+                          static_cast<uint64_t>(getBlockFrames(block)) * rowBytes(header);
+        return offset <= fileSize && fileSize - offset >= length;
+    }
+
+    // Block holding frame
+    int findBlock(uint64_t frame) const {
+        auto it = std::upper_bound(index.begin(), index.end(), frame,
+                                   [](uint64_t f, const IndexEntry& e) { return f < e.firstFrame; });
+        return static_cast<int>(it - index.begin()) - 1;
+    }
+
+    // Encoded rows of a block whose bytes start at blockData, e.g. Uint8
+    // codes to upload as a texture
+    const uint8_t* blockRows(const uint8_t* blockData) const { return blockData + blockPrefixBytes(header); }
+
+    // Mapping of a Uint8 block whose bytes start at blockData
+    Quantization blockQuantization(const uint8_t* blockData) const {
+        Quantization q;
+        if (encodingOf(header) == Encoding::Uint8) {
+            q.scale.resize(header.width);
+            q.offset.resize(header.width);
+            std::memcpy(q.scale.data(), blockData, header.width * sizeof(float));
+            std::memcpy(q.offset.data(), blockData + header.width * sizeof(float), header.width * sizeof(float));
+        }
+        return q;
+    }
+
+    // Decodes numRows rows starting at row firstRow of a block whose bytes
+    // start at blockData
+    void decode(const uint8_t* blockData, int firstRow, int numRows, float* rows) const {
+        decodeRows(header, blockQuantization(blockData),
+                   blockRows(blockData) + static_cast<size_t>(firstRow) * rowBytes(header), numRows, rows);
+    }
+
+    // Decodes frames [firstFrame, firstFrame + numFrames) from a whole file in
+    // memory; returns the number of frames written
+    int readFrames(const uint8_t* file, uint64_t firstFrame, int numFrames, float* rows) const {
+        int done = 0;
+        while (done < numFrames && firstFrame + done < header.numFrames) {
+            uint64_t frame = firstFrame + done;
+            int block = findBlock(frame);
+            int row = static_cast<int>(frame - index[block].firstFrame);
+            int count = std::min(numFrames - done, getBlockFrames(block) - row);
+            decode(file + index[block].byteOffset, row, count, rows + static_cast<size_t>(done) * header.width);
+            done += count;
+        }
+        return done;
+    }
+
+private:
+    Header header = {};
+    std::vector<IndexEntry> index;
+
+    bool validIndex() const {
+        if (index.empty()) return header.numFrames == 0;
+        if (index[0].firstFrame != 0) return false;
+        for (size_t b = 0; b < index.size(); b++) {
+            uint64_t end = b + 1 < index.size() ? index[b + 1].firstFrame : header.numFrames;
+            if (end <= index[b].firstFrame || end - index[b].firstFrame > header.framesPerBlock) return false;
+        }
+        return true;
+    }
+};
+
+// Heap-facing wrappers for the embind module: rows are passed as byte
+// offsets into the module heap (e.g. getStreamOutputPtr() after a push) and
+// the file bytes live in a buffer JS reads or fills through a heap view.
+class HeapWriter {
+public:
+    HeapWriter(const ProcessorConfig& config, Encoding encoding, int framesPerBlock)
+        : writer(makeHeader(sanitizeConfig(config), encoding, static_cast<uint32_t>(std::max(1, framesPerBlock)))) {}
+
+    bool writeFromHeap(uintptr_t rowsPtr, int numRows) {
+        return writer.write(reinterpret_cast<const float*>(rowsPtr), numRows);
+    }
+    // Completes the file; the bytes are final afterwards
+    bool finish() { return writer.finish(); }
+
+    double getNumFrames() const { return static_cast<double>(writer.getHeader().numFrames); }
+    uintptr_t getBytesPtr() const { return reinterpret_cast<uintptr_t>(writer.getBytes().data()); }
+    int getBytesSize() const { return static_cast<int>(writer.getBytes().size()); }
+
+private:
+    BufferWriter writer;
+};
+
+class HeapReader {
+public:
+    // Makes room for a whole file of byteLength bytes and returns where JS
+    // should copy it before calling parse()
+    uintptr_t allocate(int byteLength) {
+        parsed = false;
+        bytes.assign(static_cast<size_t>(std::max(0, byteLength)), 0);
+        return reinterpret_cast<uintptr_t>(bytes.data());
+    }
+
+    bool parse() {
+        parsed = false;
+        Header header;
+        if (!parseHeader(bytes.data(), bytes.size(), header) || header.indexOffset > bytes.size()) return false;
+        // Reader::load bounds numBlocks by the bytes after indexOffset
+        size_t indexSize = bytes.size() - static_cast<size_t>(header.indexOffset);
+        if (!reader.load(bytes.data(), bytes.size(), bytes.data() + header.indexOffset, indexSize)) return false;
+        for (int b = 0; b < reader.getNumBlocks(); b++) {
+            if (!reader.blockFits(b, bytes.size())) return false;
+        }
+        parsed = true;
+        return true;
+    }
+
+    double getNumFrames() const { return parsed ? static_cast<double>(reader.getHeader().numFrames) : 0.0; }
+    int getWidth() const { return static_cast<int>(reader.getHeader().width); }
+    int getNumCoeffs() const { return static_cast<int>(reader.getHeader().numCoeffs); }
+    int getDeltaOrder() const { return static_cast<int>(reader.getHeader().deltaOrder); }
+    float getSampleRate() const { return reader.getHeader().sampleRate; }
+    int getHopLength() const { return static_cast<int>(reader.getHeader().hopLength); }
+    int getVersion() const { return static_cast<int>(reader.getHeader().version); }
+    Encoding getEncoding() const { return encodingOf(reader.getHeader()); }
+
+    int getNumBlocks() const { return parsed ? reader.getNumBlocks() : 0; }
+    int getBlockFrames(int block) const { return reader.getBlockFrames(block); }
+    // Encoded rows of a block (getBlockFrames() * width values), e.g. Uint8
+    // codes to upload straight into a texture
+    uintptr_t getBlockRowsPtr(int block) const {
+        return reinterpret_cast<uintptr_t>(reader.blockRows(bytes.data() + reader.getBlockOffset(block)));
+    }
+    int getBlockRowsSize(int block) const {
+        return reader.getBlockFrames(block) * static_cast<int>(rowBytes(reader.getHeader()));
+    }
+
+    // Decodes numFrames frames from firstFrame to outPtr (numFrames * width
+    // floats); returns the number decoded
+    int readFramesToHeap(double firstFrame, int numFrames, uintptr_t outPtr) const {
+        if (!parsed || firstFrame < 0) return 0;
+        return reader.readFrames(bytes.data(), static_cast<uint64_t>(firstFrame), numFrames,
+                                 reinterpret_cast<float*>(outPtr));
+    }
+
+private:
+    std::vector<uint8_t> bytes;
+    Reader reader;
+    bool parsed = false;
+};
+
+}  // namespace feature_file
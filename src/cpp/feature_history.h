@@ -0,0 +1,89 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include "normalizer.h"
+
+// Display-ready history of coefficient frames, laid out exactly like the
+// renderer's history texture: one row of numCoeffs values per frame, rows used
+// as a circular buffer, and each row reversed so C0 is the last texel (the
+// bottom of the spectrogram). Frames go through the Normalizer first, so the
+// GPU can upload rows straight from the heap. With quantization enabled the
+// rows are also kept as uint8 (minValue..maxValue -> 0..255) for devices
+// without float textures.
+class FeatureHistory {
+public:
+    FeatureHistory(int numCoeffs, int numRows)
+        : numCoeffs(numCoeffs),
+          numRows(std::max(1, numRows)),
+          values(static_cast<size_t>(this->numRows) * numCoeffs, 0.0f),
+          normalizer(numCoeffs),
+          normalized(numCoeffs, 0.0f) {}
+
+    int getNumCoeffs() const { return numCoeffs; }
+    int getNumRows() const { return numRows; }
+    // Row the next frame goes to; the row after the newest frame holds the oldest
+    int getWriteRow() const { return writeRow; }
+    // Total frames written, lets a consumer upload only the rows it has not seen
+    int getFramesWritten() const { return framesWritten; }
+    const float* data() const { return values.data(); }
+    int size() const { return static_cast<int>(values.size()); }
+
+    Normalizer& getNormalizer() { return normalizer; }
+
+    // Keeps a uint8 copy of every row; allocates once when first enabled
+    void setQuantized(bool enabled) {
+        quantized = enabled;
+        if (enabled && bytes.empty()) {
+            bytes.assign(values.size(), 0);
+            // Rows written so far are quantized now so both copies agree
+            for (int r = 0; r < numRows; r++) quantizeRow(r);
+        }
+    }
+    bool isQuantized() const { return quantized; }
+    const uint8_t* byteData() const { return bytes.data(); }
+    int byteSize() const { return static_cast<int>(bytes.size()); }
+
+    void push(const float* coeffs) {
+        normalizer.apply(coeffs, normalized.data());
+        float* row = values.data() + static_cast<size_t>(writeRow) * numCoeffs;
+        for (int k = 0; k < numCoeffs; k++) {
+            row[numCoeffs - 1 - k] = normalized[k];
+        }
+        if (quantized) quantizeRow(writeRow);
+        writeRow = (writeRow + 1) % numRows;
+        framesWritten++;
+    }
+
+    void clear() {
+        std::fill(values.begin(), values.end(), 0.0f);
+        std::fill(bytes.begin(), bytes.end(), 0);
+        normalizer.reset();
+        writeRow = 0;
+        framesWritten = 0;
+    }
+
+private:
+    int numCoeffs;
+    int numRows;
+    std::vector<float> values;
+    std::vector<uint8_t> bytes;
+    Normalizer normalizer;
+    std::vector<float> normalized;  // one frame in coefficient order
+    bool quantized = false;
+    int writeRow = 0;
+    int framesWritten = 0;
+
+    void quantizeRow(int r) {
+        size_t begin = static_cast<size_t>(r) * numCoeffs;
+        float lo = normalizer.getMinValue();
+        float span = normalizer.getMaxValue() - lo;
+        float toByte = span > 0.0f ? 255.0f / span : 0.0f;
+        for (int k = 0; k < numCoeffs; k++) {
+            float q = (values[begin + k] - lo) * toByte;
+            bytes[begin + k] = static_cast<uint8_t>(std::min(std::max(q, 0.0f), 255.0f));
+        }
+    }
+};
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <vector>
+#include <complex>
+#include <cmath>
+#include <utility>
+#include <algorithm>
+
+#include "simd_kernels.h"
+#include "baked_tables.h"
+
+// e^(-2πij/len), evaluated in double precision and rounded once (or taken
+// from the baked table, which holds the same values)
+inline std::complex<float> fftTwiddle(int j, int len) {
+    std::complex<float> baked;
+    if (baked_tables::twiddle(j, len, baked)) return baked;
+    double angle = -2.0 * M_PI * j / len;
+    return std::complex<float>(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+}
+
+// Bit-reversed index of i in a 2^bits-point transform
+constexpr int bitReverse(int i, int bits) {
+    int rev = 0;
+    for (int j = 0; j < bits; j++) {
+        rev = (rev << 1) | ((i >> j) & 1);
+    }
+    return rev;
+}
+
+// Packs n real samples, windowed and zero-padded past inputLength, as the m =
+// n/2 complex values z[k] = x[2k] + i*x[2k+1] of the real-input transform
+inline void packWindowed(const float* input, const float* window, int inputLength, int m,
+                         std::complex<float>* out) {
+    int pairs = std::min(inputLength / 2, m);
+
+    for (int k = 0; k < pairs; k++) {
+        out[k] = std::complex<float>(input[2 * k] * window[2 * k],
+                                     input[2 * k + 1] * window[2 * k + 1]);
+    }
+    int k = pairs;
+    if (k < m && 2 * k < inputLength) {
+        // Odd inputLength: last sample has no odd partner
+        out[k] = std::complex<float>(input[2 * k] * window[2 * k], 0.0f);
+        k++;
+    }
+    for (; k < m; k++) {
+        out[k] = std::complex<float>(0.0f, 0.0f);
+    }
+}
+
+// Turns the m-point FFT of packed data into the m+1 bins of the 2m-point real
+// transform, in place. splitTwiddles[k] = fftTwiddle(k, 2m) for k <= m/2.
+inline void splitPackedSpectrum(std::complex<float>* out, int m, const std::complex<float>* splitTwiddles) {
+    // DC and Nyquist are both real and come from Z[0]
+    float re0 = out[0].real();
+    float im0 = out[0].imag();
+    out[0] = std::complex<float>(re0 + im0, 0.0f);
+    out[m] = std::complex<float>(re0 - im0, 0.0f);
+
+    // Split the remaining bins pairwise (k, m-k) so the update stays in place:
+    //   E = (Z[k] + conj(Z[m-k])) / 2,  O = -i/2 * (Z[k] - conj(Z[m-k]))
+    //   X[k] = E + W^k O,  X[m-k] = conj(E - W^k O)
+    for (int k = 1; k <= m / 2; k++) {
+        std::complex<float> zk = out[k];
+        std::complex<float> zmk = out[m - k];
+
+        float eRe = 0.5f * (zk.real() + zmk.real());
+        float eIm = 0.5f * (zk.imag() - zmk.imag());
+        float oRe = 0.5f * (zk.imag() + zmk.imag());
+        float oIm = -0.5f * (zk.real() - zmk.real());
+
+        const std::complex<float>& w = splitTwiddles[k];
+        float tRe = w.real() * oRe - w.imag() * oIm;
+        float tIm = w.real() * oIm + w.imag() * oRe;
+
+        out[k] = std::complex<float>(eRe + tRe, eIm + tIm);
+        out[m - k] = std::complex<float>(eRe - tRe, -(eIm - tIm));
+    }
+}
+
+// Precomputed radix-2 FFT plan for a fixed power-of-2 size.
+// Holds the bit-reversal permutation and the per-stage twiddle tables, both
+// built once so executing the plan does no trigonometry or bit twiddling.
+class FftPlan {
+public:
+    explicit FftPlan(int n) : n(n), bitReversal(n), twiddles(n > 1 ? n - 1 : 0) {
+        int bits = 0;
+        while ((1 << bits) < n) bits++;
+
+        for (int i = 0; i < n; i++) {
+            bitReversal[i] = bitReverse(i, bits);
+        }
+
+        // Twiddles evaluated directly in double precision, so no error builds
+        // up from repeatedly multiplying by the stage root. They are stored
+        // per stage (stage `len` holds e^(-2πij/len) for j < len/2 starting at
+        // offset len/2 - 1) so every butterfly group reads them contiguously.
+        for (int len = 2; len <= n; len <<= 1) {
+            int half = len / 2;
+            for (int j = 0; j < half; j++) {
+                twiddles[half - 1 + j] = fftTwiddle(j, len);
+            }
+        }
+    }
+
+    int size() const { return n; }
+
+    // In-place forward transform of exactly size() values
+    void execute(std::complex<float>* data) const {
+        // Bit-reversal permutation
+        for (int i = 0; i < n; i++) {
+            int rev = bitReversal[i];
+            if (i < rev) {
+                std::swap(data[i], data[rev]);
+            }
+        }
+
+        // Cooley-Tukey butterflies
+        for (int len = 2; len <= n; len <<= 1) {
+            int half = len / 2;
+            const std::complex<float>* stageTwiddles = twiddles.data() + half - 1;
+
+            for (int i = 0; i < n; i += len) {
+                kernels::butterflies(data + i, data + i + half, stageTwiddles, half);
+            }
+        }
+    }
+
+private:
+    int n;
+    std::vector<int> bitReversal;
+    std::vector<std::complex<float>> twiddles;
+};
+
+// Real-input FFT of size n computed through an n/2 complex transform.
+// Even/odd samples are packed as z[k] = x[2k] + i*x[2k+1], transformed with an
+// FftPlan of size n/2 and split back into the n/2+1 non-redundant bins.
+class RealFftPlan {
+public:
+    explicit RealFftPlan(int n) : n(n), halfPlan(n / 2), splitTwiddles(n / 4 + 1) {
+        for (int k = 0; k <= n / 4; k++) {
+            splitTwiddles[k] = fftTwiddle(k, n);
+        }
+    }
+
+    int size() const { return n; }
+    int numBins() const { return n / 2 + 1; }
+
+    // Transforms size() real samples into numBins() complex bins written to out
+    void execute(const float* input, std::complex<float>* out) const {
+        int m = n / 2;
+
+        // Pack even/odd samples into m complex values
+        for (int k = 0; k < m; k++) {
+            out[k] = std::complex<float>(input[2 * k], input[2 * k + 1]);
+        }
+
+        transformPacked(out);
+    }
+
+    // Same transform with the analysis window and zero-padding fused into the
+    // packing load: sample i is input[i] * window[i] for i < inputLength and
+    // zero up to size(), so the caller needs no separate windowed frame copy.
+    void executeWindowed(const float* input, const float* window, int inputLength,
+                         std::complex<float>* out) const {
+        packWindowed(input, window, inputLength, n / 2, out);
+        transformPacked(out);
+    }
+
+    // Runs the n/2-point FFT on data packed by packWindowed and splits it into
+    // numBins() bins, in place (out holds numBins() values)
+    void transformPacked(std::complex<float>* out) const {
+        halfPlan.execute(out);
+        splitPackedSpectrum(out, n / 2, splitTwiddles.data());
+    }
+
+private:
+    int n;
+    FftPlan halfPlan;
+    std::vector<std::complex<float>> splitTwiddles;
+};
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "simd_kernels.h"
+#include "baked_tables.h"
+
+// Triangular mel filterbank stored sparsely.
+// Each band keeps only its nonzero span [startBin, endBin) and the weights for
+// that span live back to back in one flat arena, so applying the bank costs
+// about 2 multiply-adds per spectrum bin instead of numBands per bin.
+class MelFilterbank {
+public:
+    struct Band {
+        int startBin;
+        int endBin;        // exclusive
+        int weightOffset;  // index of the band's first weight in the arena
+    };
+
+    MelFilterbank(int fftSize, float sampleRate, int numBands, float fMin, float fMax)
+        : filterLength(fftSize / 2 + 1) {
+        bands.reserve(numBands);
+        if (const BakedMelTable* baked = baked_tables::melFilterbank(fftSize, sampleRate, numBands, fMin, fMax)) {
+            for (int i = 0; i < numBands; i++) {
+                bands.push_back({baked->spans[3 * i], baked->spans[3 * i + 1], baked->spans[3 * i + 2]});
+            }
+            weights.assign(baked->weights, baked->weights + baked->numWeights);
+            return;
+        }
+
+        // Convert Hz to mel scale
+        auto hzToMel = [](float hz) { return 2595.0f * std::log10(1.0f + hz / 700.0f); };
+        auto melToHz = [](float mel) { return 700.0f * (std::pow(10.0f, mel / 2595.0f) - 1.0f); };
+
+        float melMax = hzToMel(fMax);
+        float melMin = hzToMel(fMin);
+        float melStep = (melMax - melMin) / (numBands + 1);
+
+        // Dense row reused while building each band, only the nonzero span is kept
+        std::vector<float> filter(filterLength);
+
+        for (int i = 0; i < numBands; i++) {
+            float melCenter = melMin + (i + 1) * melStep;
+            float melLeft = melMin + i * melStep;
+            float melRight = melMin + (i + 2) * melStep;
+
+            float hzLeft = melToHz(melLeft);
+            float hzCenter = melToHz(melCenter);
+            float hzRight = melToHz(melRight);
+
+            int binLeft = static_cast<int>(std::floor(hzLeft * filterLength / (sampleRate/2)));
+            int binCenter = static_cast<int>(std::floor(hzCenter * filterLength / (sampleRate/2)));
+            int binRight = static_cast<int>(std::floor(hzRight * filterLength / (sampleRate/2)));
+
+            // Ensure bins are within valid range
+            binLeft = std::max(0, std::min(filterLength-1, binLeft));
+            binCenter = std::max(0, std::min(filterLength-1, binCenter));
+            binRight = std::max(0, std::min(filterLength-1, binRight));
+
+            std::fill(filter.begin() + binLeft, filter.begin() + binRight + 1, 0.0f);
+
+            // Create triangular filters
+            for (int j = binLeft; j <= binCenter; j++) {
+                if (binCenter > binLeft)  // Avoid division by zero
+                    filter[j] = (j - binLeft) / float(binCenter - binLeft);
+            }
+            for (int j = binCenter; j <= binRight; j++) {
+                if (binRight > binCenter)  // Avoid division by zero
+                    filter[j] = (binRight - j) / float(binRight - binCenter);
+            }
+
+            // Trim the zero edges of the triangle
+            int start = binLeft;
+            int end = binRight + 1;
+            while (start < end && filter[start] == 0.0f) start++;
+            while (end > start && filter[end - 1] == 0.0f) end--;
+
+            bands.push_back({start, end, static_cast<int>(weights.size())});
+            weights.insert(weights.end(), filter.begin() + start, filter.begin() + end);
+        }
+
+        weights.shrink_to_fit();
+    }
+
+    int getNumBands() const { return static_cast<int>(bands.size()); }
+    int getFilterLength() const { return filterLength; }
+    const std::vector<Band>& getBands() const { return bands; }
+    const std::vector<float>& getWeights() const { return weights; }
+
+    // Writes one energy per band. Bins past numBins are treated as zero.
+    void apply(const float* powerSpectrum, int numBins, float* melEnergies) const {
+        for (size_t i = 0; i < bands.size(); i++) {
+            const Band& band = bands[i];
+            int length = std::min(band.endBin, numBins) - band.startBin;
+
+            melEnergies[i] = length > 0
+                ? kernels::dot(powerSpectrum + band.startBin, weights.data() + band.weightOffset, length)
+                : 0.0f;
+        }
+    }
+
+private:
+    int filterLength;
+    std::vector<Band> bands;
+    std::vector<float> weights;
+};
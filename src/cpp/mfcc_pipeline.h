@@ -0,0 +1,205 @@
+#pragma once
+
+#include <array>
+#include <complex>
+#include <memory>
+#include <utility>
+#include <algorithm>
+
+#include "processor_config.h"
+#include "fft_plan.h"
+#include "dct.h"
+#include "baked_tables.h"
+#include "scratch_arena.h"
+#include "perf_stats.h"
+#include "simd_kernels.h"
+
+// Frame path (steps 1-6) behind a SignalProcessor, for shapes with a
+// compile-time specialization
+class FramePipeline {
+public:
+    virtual ~FramePipeline() = default;
+
+    // Same contract as SignalProcessor::computeCoefficients: numCoeffs values
+    // to coeffs, working only in `work`, stage times added to stats if non-null
+    virtual void compute(const float* samples, int count, float* coeffs,
+                         FrameScratch& work, PerfStats* stats) const = 0;
+};
+
+#ifndef SIGNAL_PROCESSOR_NO_BAKED_TABLES
+
+// Real-FFT MFCC frame path for the baked default shape (see baked_tables.h):
+// 1024-point Hamming frames, 40 bands, 13 coefficients, with MelTable picking
+// the sample rate from default_tables::kMelTables. Every table is a constant:
+// the bit reversal and the per-stage FFT twiddles are evaluated at compile
+// time from the baked ones, and the window, mel spans and DCT basis are the
+// baked arrays themselves. So every loop has a constant trip count, each mel
+// band's span and weights are known at compile time, and the first two FFT
+// stages (twiddles 1 and -i) fold into one pass. The arithmetic is the runtime
+// path's, operation for operation, so results are bit-identical.
+template <int MelTable>
+class MfccPipeline : public FramePipeline {
+public:
+    static constexpr int kFftSize = default_tables::kWindowLength;
+    static constexpr int kHalf = kFftSize / 2;
+    static constexpr int kNumBins = kFftSize / 2 + 1;
+    static constexpr int kBands = default_tables::kDctInputs;
+    static constexpr int kCoeffs = default_tables::kDctCoeffs;
+    static constexpr const BakedMelTable& kMel = default_tables::kMelTables[MelTable];
+
+    static_assert(kMel.fftSize == kFftSize && kMel.numBands == kBands, "baked tables disagree on the shape");
+    static_assert(2 * kHalf <= default_tables::kTwiddleSize, "baked twiddles too short for the split");
+    static_assert(!DctPlan::useFftPath(kBands, kCoeffs), "only the mat-vec DCT is baked");
+
+    static bool matches(const ProcessorConfig& config) {
+        return config.fftSize == kFftSize && config.frameLength == kFftSize &&
+               config.windowType == WindowType::Hamming && config.numBands == kBands &&
+               config.numCoeffs == kCoeffs && config.sampleRate == kMel.sampleRate &&
+               config.fMin == kMel.fMin && config.fMax == kMel.fMax;
+    }
+
+    void compute(const float* samples, int count, float* coeffs,
+                 FrameScratch& work, PerfStats* stats) const override {
+        StageClock clock(stats != nullptr);
+
+        // Steps 1+2: windowed packing load and the real-input FFT
+        packWindowed(samples, default_tables::kHammingWindow, std::min(count, kFftSize), kHalf, work.spectrum);
+        fft(work.spectrum);
+        // fftTwiddle(k, kFftSize) is baked entry k * (kTwiddleSize / kFftSize)
+        static_assert(default_tables::kTwiddleSize == kFftSize, "split twiddles are read at stride 1");
+        splitPackedSpectrum(work.spectrum, kHalf, reinterpret_cast<const std::complex<float>*>(default_tables::kTwiddles));
+        if (stats) stats->values[PerfStats::FftMs] += clock.lap();
+
+        // Step 3: power spectrum
+        kernels::complexNorm(work.spectrum, work.power, kNumBins);
+        if (stats) stats->values[PerfStats::PowerMs] += clock.lap();
+
+        // Step 4: sparse mel filterbank, one constant-length dot per band
+        applyMel(work.power, work.mel, std::make_index_sequence<kBands>());
+        if (stats) stats->values[PerfStats::MelMs] += clock.lap();
+
+        // Step 5: floored log
+        kernels::logFloor<kPrecision>(work.mel, 1e-10f, kBands);
+        if (stats) stats->values[PerfStats::LogMs] += clock.lap();
+
+        // Step 6: DCT-II mat-vec
+        for (int k = 0; k < kCoeffs; k++) {
+            coeffs[k] = kernels::dot(work.mel, default_tables::kDctBasis + k * kBands, kBands);
+        }
+        if (stats) {
+            stats->values[PerfStats::DctMs] += clock.lap();
+            stats->addFrame(clock.total());
+        }
+    }
+
+private:
+    static constexpr std::array<int, kHalf> bitReversalTable() {
+        int bits = 0;
+        while ((1 << bits) < kHalf) bits++;
+        std::array<int, kHalf> table{};
+        for (int i = 0; i < kHalf; i++) {
+            table[i] = bitReverse(i, bits);
+        }
+        return table;
+    }
+
+    // FftPlan's per-stage layout (stage len at complex offset len/2 - 1) as
+    // interleaved re/im, taken from the baked table like fftTwiddle does
+    static constexpr std::array<float, 2 * (kHalf - 1)> stageTwiddleTable() {
+        std::array<float, 2 * (kHalf - 1)> table{};
+        for (int len = 2; len <= kHalf; len <<= 1) {
+            for (int j = 0; j < len / 2; j++) {
+                int index = j * (default_tables::kTwiddleSize / len);
+                table[2 * (len / 2 - 1 + j)] = default_tables::kTwiddles[2 * index];
+                table[2 * (len / 2 - 1 + j) + 1] = default_tables::kTwiddles[2 * index + 1];
+            }
+        }
+        return table;
+    }
+
+    static constexpr std::array<int, kHalf> kBitReversal = bitReversalTable();
+    static constexpr std::array<float, 2 * (kHalf - 1)> kStageTwiddles = stageTwiddleTable();
+
+    static const std::complex<float>* stageTwiddles(int half) {
+        return reinterpret_cast<const std::complex<float>*>(kStageTwiddles.data()) + half - 1;
+    }
+
+    // kHalf-point radix-2 FFT, the same butterflies FftPlan runs
+    static void fft(std::complex<float>* data) {
+        for (int i = 0; i < kHalf; i++) {
+            int rev = kBitReversal[i];
+            if (i < rev) {
+                std::swap(data[i], data[rev]);
+            }
+        }
+
+        // Stages 2 and 4 in one pass. Twiddle 1 only adds and subtracts; the
+        // -i of stage 4 keeps its baked real part (~1e-17) so the products
+        // round exactly as butterflies() rounds them.
+        constexpr float quarterRe = kStageTwiddles[2 * 2];
+        constexpr float quarterIm = kStageTwiddles[2 * 2 + 1];
+        static_assert(kStageTwiddles[0] == 1.0f && kStageTwiddles[2] == 1.0f && quarterIm == -1.0f,
+                      "stage 2 and 4 twiddles are 1 and -i");
+        for (int i = 0; i < kHalf; i += 4) {
+            std::complex<float> a0 = data[i] + data[i + 1];
+            std::complex<float> a1 = data[i] - data[i + 1];
+            std::complex<float> a2 = data[i + 2] + data[i + 3];
+            std::complex<float> a3 = data[i + 2] - data[i + 3];
+            float vRe = quarterRe * a3.real() - quarterIm * a3.imag();
+            float vIm = quarterRe * a3.imag() + quarterIm * a3.real();
+            data[i] = a0 + a2;
+            data[i + 2] = a0 - a2;
+            data[i + 1] = std::complex<float>(a1.real() + vRe, a1.imag() + vIm);
+            data[i + 3] = std::complex<float>(a1.real() - vRe, a1.imag() - vIm);
+        }
+        stage<8>(data);
+    }
+
+    // One Cooley-Tukey stage of length Len, then the next
+    template <int Len>
+    static void stage(std::complex<float>* data) {
+        if constexpr (Len <= kHalf) {
+            constexpr int half = Len / 2;
+            for (int i = 0; i < kHalf; i += Len) {
+                kernels::butterflies(data + i, data + i + half, stageTwiddles(half), half);
+            }
+            stage<Len * 2>(data);
+        }
+    }
+
+    // Energy of band B: spans are (startBin, endBin, weightOffset)
+    template <int B>
+    static float bandEnergy(const float* power) {
+        constexpr int start = kMel.spans[3 * B];
+        constexpr int length = std::min(kMel.spans[3 * B + 1], kNumBins) - start;
+        if constexpr (length > 0) {
+            return kernels::dot(power + start, kMel.weights + kMel.spans[3 * B + 2], length);
+        } else {
+            return 0.0f;
+        }
+    }
+
+    template <size_t... B>
+    static void applyMel(const float* power, float* mel, std::index_sequence<B...>) {
+        ((mel[B] = bandEnergy<static_cast<int>(B)>(power)), ...);
+    }
+};
+
+// The baked shape at every baked sample rate. Returns null when none matches
+// and the runtime path should be used.
+inline std::unique_ptr<FramePipeline> makeSpecializedPipeline(const ProcessorConfig& config) {
+    static_assert(sizeof(default_tables::kMelTables) / sizeof(BakedMelTable) == 2, "one pipeline per baked rate");
+    if (MfccPipeline<0>::matches(config)) {
+        return std::unique_ptr<FramePipeline>(new MfccPipeline<0>());
+    }
+    if (MfccPipeline<1>::matches(config)) {
+        return std::unique_ptr<FramePipeline>(new MfccPipeline<1>());
+    }
+    return nullptr;
+}
+
+#else
+
+inline std::unique_ptr<FramePipeline> makeSpecializedPipeline(const ProcessorConfig&) { return nullptr; }
+
+#endif
@@ -0,0 +1,303 @@
+#pragma once
+
+#include <vector>
+#include <complex>
+#include <cstdint>
+#include <algorithm>
+
+#include "processor_config.h"
+#include "fft_plan.h"
+#include "mel_filterbank.h"
+#include "dct.h"
+#include "window.h"
+#include "ring_buffer.h"
+#include "scratch_arena.h"
+#include "delta_stage.h"
+#include "simd_kernels.h"
+
+// Working buffers for one multi-channel frame, carved from a single arena.
+// Everything after the FFT is structure-of-arrays: value v of channel c sits
+// at [v * lanes + c], so one kernel call covers every channel. lanes is the
+// channel count rounded up to whole 4-float vectors (1 for mono, where the
+// kernels vectorize over bins instead); the padding lanes stay zero (the
+// arena zero-fills) and are never read back.
+struct MultiChannelScratch {
+    MultiChannelScratch(const ProcessorConfig& config, int numChannels, int lanes, size_t dctScratchSize)
+        : arena(ScratchArena::bytesFor<float>(static_cast<size_t>(numChannels) * config.frameLength) +
+                ScratchArena::bytesFor<std::complex<float>>(config.fftSize / 2 + 1) +
+                ScratchArena::bytesFor<float>(static_cast<size_t>(lanes) * (config.fftSize / 2 + 1)) +
+                ScratchArena::bytesFor<float>(static_cast<size_t>(lanes) * config.numBands) +
+                ScratchArena::bytesFor<float>(static_cast<size_t>(lanes) * config.numCoeffs) +
+                ScratchArena::bytesFor<float>(config.numBands) +
+                ScratchArena::bytesFor<float>(config.numCoeffs) +
+                ScratchArena::bytesFor<std::complex<float>>(dctScratchSize)),
+          frames(arena.allocate<float>(static_cast<size_t>(numChannels) * config.frameLength)),
+          spectrum(arena.allocate<std::complex<float>>(config.fftSize / 2 + 1)),
+          power(arena.allocate<float>(static_cast<size_t>(lanes) * (config.fftSize / 2 + 1))),
+          mel(arena.allocate<float>(static_cast<size_t>(lanes) * config.numBands)),
+          coeffs(arena.allocate<float>(static_cast<size_t>(lanes) * config.numCoeffs)),
+          dctInput(arena.allocate<float>(config.numBands)),
+          dctOutput(arena.allocate<float>(config.numCoeffs)),
+          dct(arena.allocate<std::complex<float>>(dctScratchSize)) {}
+
+    ScratchArena arena;
+    float* frames;                  // numChannels x frameLength, planar, filled by the caller
+    std::complex<float>* spectrum;  // fftSize/2+1 bins of the channel being transformed
+    float* power;                   // (fftSize/2+1) x lanes
+    float* mel;                     // numBands x lanes (log energies after step 5)
+    float* coeffs;                  // numCoeffs x lanes
+    float* dctInput;                // one channel's log energies for the FFT-based DCT
+    float* dctOutput;
+    std::complex<float>* dct;       // FFT-based DCT work area, may be empty
+};
+
+// MFCC pipeline for several synchronized channels (stereo, mic arrays) in one
+// object. The FFT plan, window, filterbank and DCT basis are built once and
+// shared by every channel; only the sample rings and delta history are per
+// channel. Each frame runs the FFT per channel, then the power spectrum, mel
+// filterbank, log and DCT across all channels at once on the SoA buffers,
+// with the operations of SignalProcessor's real-FFT path in the same order
+// (the SoA stride is padded to a multiple of 4 channels, so stereo gets the
+// vector kernels too):
+// output is bit-identical to one SignalProcessor per channel in the scalar
+// build and within rounding of it with SIMD.
+//
+// Output frames hold one row of getOutputWidth() floats per channel, channel
+// 0 first. The display history and the sliding DFT engine are single-channel
+// features and are not available here; getConfig() reports SpectrumEngine::Fft.
+class MultiChannelProcessor {
+public:
+    static constexpr int kMaxChannels = 32;
+    // Largest push (samples per channel) that can never overrun the stream output buffer
+    static constexpr int kMaxPushSamples = 8192;
+
+    MultiChannelProcessor(const ProcessorConfig& requested, int numChannels)
+        : config(fftOnly(sanitizeConfig(requested))),
+          numChannels(std::max(1, std::min(numChannels, kMaxChannels))),
+          lanes(this->numChannels == 1 ? 1 : (this->numChannels + 3) & ~3),
+          realFftPlan(config.fftSize),
+          melFilterbank(config.fftSize, config.sampleRate, config.numBands, config.fMin, config.fMax),
+          dctPlan(config.numBands, config.numCoeffs),
+          window(buildWindow(config.windowType, config.frameLength)),
+          streamRings(this->numChannels, SampleRingBuffer(config.frameLength)),
+          deltaStages(this->numChannels, DeltaStage(config)),
+          channelChunk(config.frameLength, 0.0f),
+          streamInput(static_cast<size_t>(kMaxPushSamples) * this->numChannels, 0.0f),
+          streamOutput(static_cast<size_t>(getMaxFramesPerPush()) * this->numChannels * outputWidth(config), 0.0f),
+          samplesUntilFrame(config.frameLength),
+          scratch(config, this->numChannels, lanes, dctPlan.getScratchSize()) {}
+
+    const ProcessorConfig& getConfig() const { return config; }
+    int getNumChannels() const { return numChannels; }
+
+    // Floats per channel row: numCoeffs, or 2x/3x that with deltaOrder 1/2
+    int getOutputWidth() const { return outputWidth(config); }
+    // Floats per output frame, all channels
+    int getFrameStride() const { return numChannels * outputWidth(config); }
+
+    // Streaming API, as SignalProcessor::pushSamples for every channel at once.
+    // Interleaved input holds n samples per channel as samples[i * numChannels + c]
+    // (the layout of multi-channel WAV/PCM); planar input holds numChannels
+    // blocks of n samples back to back (the layout of AudioBuffer channel data).
+    // Returns the number of frames written to the stream output buffer,
+    // getFrameStride() floats each.
+    int pushInterleaved(const float* samples, int n) { return push(samples, n, numChannels, 1); }
+    int pushPlanar(const float* samples, int n) { return push(samples, n, 1, n); }
+
+    // Pointer-as-integer entry points for bindings, usually with getStreamInputPtr()
+    int pushInterleavedFromHeap(uintptr_t ptr, int n) {
+        return pushInterleaved(reinterpret_cast<const float*>(ptr), n);
+    }
+    int pushPlanarFromHeap(uintptr_t ptr, int n) {
+        return pushPlanar(reinterpret_cast<const float*>(ptr), n);
+    }
+
+    // Batch API, as SignalProcessor::processBatch: frame f of every channel
+    // starts f * hop samples in, and its rows land at output + f * getFrameStride().
+    // Planar input has channel c at input + c * channelStride.
+    void processBatchInterleaved(const float* input, int numFrames, int hop, float* output) {
+        processBatch(input, numFrames, hop, numChannels, 1, output);
+    }
+    void processBatchPlanar(const float* input, int channelStride, int numFrames, int hop, float* output) {
+        processBatch(input, numFrames, hop, 1, channelStride, output);
+    }
+
+    void processBatchInterleavedFromHeap(uintptr_t inputPtr, int numFrames, int hop, uintptr_t outputPtr) {
+        processBatchInterleaved(reinterpret_cast<const float*>(inputPtr), numFrames, hop,
+                                reinterpret_cast<float*>(outputPtr));
+    }
+    void processBatchPlanarFromHeap(uintptr_t inputPtr, int channelStride, int numFrames, int hop,
+                                    uintptr_t outputPtr) {
+        processBatchPlanar(reinterpret_cast<const float*>(inputPtr), channelStride, numFrames, hop,
+                           reinterpret_cast<float*>(outputPtr));
+    }
+
+    // Forgets all buffered samples and delta history on every channel
+    void resetStream() {
+        for (SampleRingBuffer& ring : streamRings) ring.clear();
+        for (DeltaStage& stage : deltaStages) stage.reset();
+        samplesUntilFrame = config.frameLength;
+    }
+
+    int getDeltaDelay() const { return deltaStages[0].getDelay(); }
+    int getMaxFramesPerPush() const { return kMaxPushSamples / config.hopLength + 1; }
+    int getDroppedFrames() const { return droppedFrames; }
+
+    uintptr_t getStreamInputPtr() const { return reinterpret_cast<uintptr_t>(streamInput.data()); }
+    int getStreamInputLength() const { return static_cast<int>(streamInput.size()); }
+    uintptr_t getStreamOutputPtr() const { return reinterpret_cast<uintptr_t>(streamOutput.data()); }
+    int getStreamOutputLength() const { return static_cast<int>(streamOutput.size()); }
+
+private:
+    static ProcessorConfig fftOnly(ProcessorConfig config) {
+        config.spectrumEngine = SpectrumEngine::Fft;
+        return config;
+    }
+
+    ProcessorConfig config;
+    int numChannels;
+    int lanes;  // SoA stride of the scratch buffers, see MultiChannelScratch
+    RealFftPlan realFftPlan;
+    MelFilterbank melFilterbank;
+    DctPlan dctPlan;
+    std::vector<float> window;
+
+    // Streaming engine state; all channels advance together
+    std::vector<SampleRingBuffer> streamRings;
+    std::vector<DeltaStage> deltaStages;
+    std::vector<float> channelChunk;  // one channel of a deinterleaved push chunk
+    std::vector<float> streamInput;
+    std::vector<float> streamOutput;
+    int samplesUntilFrame;
+    int droppedFrames = 0;
+
+    MultiChannelScratch scratch;
+
+    // Sample i of channel c is samples[i * sampleStride + c * channelStride]
+    int push(const float* samples, int n, int sampleStride, int channelStride) {
+        int frames = 0;
+        int done = 0;
+        while (done < n) {
+            int chunk = std::min(n - done, samplesUntilFrame);
+            for (int c = 0; c < numChannels; c++) {
+                const float* src = samples + static_cast<size_t>(done) * sampleStride +
+                                   static_cast<size_t>(c) * channelStride;
+                if (sampleStride == 1) {
+                    streamRings[c].write(src, chunk);
+                } else {
+                    for (int i = 0; i < chunk; i++) {
+                        channelChunk[i] = src[static_cast<size_t>(i) * sampleStride];
+                    }
+                    streamRings[c].write(channelChunk.data(), chunk);
+                }
+            }
+            done += chunk;
+            samplesUntilFrame -= chunk;
+
+            if (samplesUntilFrame == 0) {
+                samplesUntilFrame = config.hopLength;
+                if (frames < getMaxFramesPerPush()) {
+                    for (int c = 0; c < numChannels; c++) {
+                        streamRings[c].copyLatest(scratch.frames + static_cast<size_t>(c) * config.frameLength,
+                                                  config.frameLength);
+                    }
+                    float* frameOut = streamOutput.data() + static_cast<size_t>(frames) * getFrameStride();
+                    computeFrame(scratch, frameOut);
+                    int width = outputWidth(config);
+                    for (int c = 0; c < numChannels; c++) {
+                        deltaStages[c].push(frameOut + c * width, frameOut + c * width);
+                    }
+                    frames++;
+                } else {
+                    droppedFrames++;
+                }
+            }
+        }
+        return frames;
+    }
+
+    void processBatch(const float* input, int numFrames, int hop, int sampleStride, int channelStride,
+                      float* output) {
+        int width = outputWidth(config);
+        for (int f = 0; f < numFrames; f++) {
+            const float* frameStart = input + static_cast<size_t>(f) * hop * sampleStride;
+            for (int c = 0; c < numChannels; c++) {
+                const float* src = frameStart + static_cast<size_t>(c) * channelStride;
+                float* dst = scratch.frames + static_cast<size_t>(c) * config.frameLength;
+                for (int i = 0; i < config.frameLength; i++) {
+                    dst[i] = src[static_cast<size_t>(i) * sampleStride];
+                }
+            }
+            computeFrame(scratch, output + static_cast<size_t>(f) * getFrameStride());
+        }
+        if (config.deltaOrder > 0) {
+            for (int c = 0; c < numChannels; c++) {
+                DeltaStage::applyAligned(config, output + c * width, numFrames, getFrameStride());
+            }
+        }
+    }
+
+    // Steps 1-6 on the planar frames in work.frames; writes numCoeffs statics
+    // to each channel's row of out (getOutputWidth() floats apart)
+    void computeFrame(MultiChannelScratch& work, float* out) const {
+        int numBins = config.fftSize / 2 + 1;
+        int numBands = config.numBands;
+        int numCoeffs = config.numCoeffs;
+
+        // Steps 1-3: windowed real FFT per channel, power spectrum scattered
+        // into the bin-major SoA layout
+        for (int c = 0; c < numChannels; c++) {
+            realFftPlan.executeWindowed(work.frames + static_cast<size_t>(c) * config.frameLength, window.data(),
+                                        config.frameLength, work.spectrum);
+            for (int k = 0; k < numBins; k++) {
+                const std::complex<float>& bin = work.spectrum[k];
+                work.power[k * lanes + c] = bin.real() * bin.real() + bin.imag() * bin.imag();
+            }
+        }
+
+        // Step 4: sparse mel filterbank, each band a weighted sum of bin rows
+        // (all lanes, so the kernel never falls back to its scalar tail)
+        const std::vector<float>& weights = melFilterbank.getWeights();
+        for (int b = 0; b < numBands; b++) {
+            const MelFilterbank::Band& band = melFilterbank.getBands()[b];
+            int length = std::max(0, std::min(band.endBin, numBins) - band.startBin);
+            kernels::weightedColumnSum(work.power + band.startBin * lanes, lanes,
+                                       weights.data() + band.weightOffset, length,
+                                       work.mel + b * lanes, lanes);
+        }
+
+        // Step 5: floored log of every band of every channel, skipping the
+        // padding lanes (the log is the costliest step per value)
+        if (lanes == numChannels) {
+            kernels::logFloor<kPrecision>(work.mel, 1e-10f, numBands * lanes);
+        } else {
+            for (int b = 0; b < numBands; b++) {
+                kernels::logFloor<kPrecision>(work.mel + b * lanes, 1e-10f, numChannels);
+            }
+        }
+
+        // Step 6: DCT-II, one basis row at a time across channels, or per
+        // channel through the FFT route when the plan uses it
+        int width = outputWidth(config);
+        if (dctPlan.usesFft()) {
+            for (int c = 0; c < numChannels; c++) {
+                for (int b = 0; b < numBands; b++) {
+                    work.dctInput[b] = work.mel[b * lanes + c];
+                }
+                dctPlan.apply(work.dctInput, work.dctOutput, work.dct);
+                std::copy(work.dctOutput, work.dctOutput + numCoeffs, out + c * width);
+            }
+            return;
+        }
+        const std::vector<float>& basis = dctPlan.getBasis();
+        for (int k = 0; k < numCoeffs; k++) {
+            kernels::weightedColumnSum(work.mel, lanes, basis.data() + k * numBands, numBands,
+                                       work.coeffs + k * lanes, lanes);
+        }
+        for (int c = 0; c < numChannels; c++) {
+            for (int k = 0; k < numCoeffs; k++) {
+                out[c * width + k] = work.coeffs[k * lanes + c];
+            }
+        }
+    }
+};
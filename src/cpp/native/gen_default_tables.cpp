@@ -0,0 +1,152 @@
+// Generates default_tables_data.h, the tables baked into every build for the
+// default processor shape (see baked_tables.h).
+// Built with SIGNAL_PROCESSOR_NO_BAKED_TABLES, so the tables come from the
+// runtime builders (fftTwiddle, buildWindow, MelFilterbank, DctPlan) with the
+// native flags that keep them bit-compatible with the WASM build.
+//
+// Usage: gen_default_tables output.h
+//        gen_default_tables --check existing.h   (exit 1 if it is stale)
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "processor_config.h"
+#include "fft_plan.h"
+#include "window.h"
+#include "mel_filterbank.h"
+#include "dct.h"
+
+namespace {
+
+// Largest FFT stage baked: the default fftSize, whose real transform also
+// runs the fftSize/2 complex plan
+constexpr int kTwiddleSize = 1024;
+
+// AudioContext rates the default shape is baked for
+constexpr float kSampleRates[] = {44100.0f, 48000.0f};
+
+void appendf(std::string& out, const char* format, ...) {
+    char line[256];
+    va_list args;
+    va_start(args, format);
+    std::vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    out += line;
+}
+
+// %.9g round-trips every float; the '#' keeps a decimal point so the f suffix is valid
+void appendFloats(std::string& out, const char* name, const float* values, size_t count) {
+    appendf(out, "constexpr float %s[%zu] = {\n", name, count);
+    for (size_t i = 0; i < count; i++) {
+        appendf(out, "%s%#.9gf,%s", i % 6 == 0 ? "    " : " ", values[i], i % 6 == 5 || i + 1 == count ? "\n" : "");
+    }
+    out += "};\n\n";
+}
+
+void appendInts(std::string& out, const char* name, const int* values, size_t count) {
+    appendf(out, "constexpr int %s[%zu] = {\n", name, count);
+    for (size_t i = 0; i < count; i++) {
+        appendf(out, "%s%d,%s", i % 12 == 0 ? "    " : " ", values[i], i % 12 == 11 || i + 1 == count ? "\n" : "");
+    }
+    out += "};\n\n";
+}
+
+std::string generate() {
+    ProcessorConfig defaults = sanitizeConfig(ProcessorConfig());
+    std::string out;
+    out += "// Generated by native/gen_default_tables.cpp, do not edit.\n"
+           "// Regenerate with: cmake --build <native build dir> --target regenerate_default_tables\n"
+           "#pragma once\n\n"
+           "namespace default_tables {\n\n";
+
+    // Top FFT stage, fftTwiddle(j, kTwiddleSize) for j < kTwiddleSize/2 as re, im pairs
+    std::vector<float> twiddles;
+    for (int j = 0; j < kTwiddleSize / 2; j++) {
+        std::complex<float> w = fftTwiddle(j, kTwiddleSize);
+        twiddles.push_back(w.real());
+        twiddles.push_back(w.imag());
+    }
+    appendf(out, "constexpr int kTwiddleSize = %d;\n", kTwiddleSize);
+    appendFloats(out, "kTwiddles", twiddles.data(), twiddles.size());
+
+    std::vector<float> window = buildWindow(WindowType::Hamming, defaults.frameLength);
+    appendf(out, "constexpr int kWindowLength = %d;\n", defaults.frameLength);
+    appendFloats(out, "kHammingWindow", window.data(), window.size());
+
+    std::string tables;
+    for (float sampleRate : kSampleRates) {
+        ProcessorConfig config = defaults;
+        config.sampleRate = sampleRate;
+        config.fMax = 0.0f;
+        config = sanitizeConfig(config);
+        MelFilterbank filterbank(config.fftSize, config.sampleRate, config.numBands, config.fMin, config.fMax);
+
+        std::vector<int> spans;
+        for (const MelFilterbank::Band& band : filterbank.getBands()) {
+            spans.push_back(band.startBin);
+            spans.push_back(band.endBin);
+            spans.push_back(band.weightOffset);
+        }
+        int rate = static_cast<int>(sampleRate);
+        std::string spansName = "kMel" + std::to_string(rate) + "Spans";
+        std::string weightsName = "kMel" + std::to_string(rate) + "Weights";
+        appendInts(out, spansName.c_str(), spans.data(), spans.size());
+        appendFloats(out, weightsName.c_str(), filterbank.getWeights().data(), filterbank.getWeights().size());
+        appendf(tables, "    {%#.9gf, %d, %d, %#.9gf, %#.9gf, %s, %s, %zu},\n", config.sampleRate, config.fftSize,
+                config.numBands, config.fMin, config.fMax, spansName.c_str(), weightsName.c_str(),
+                filterbank.getWeights().size());
+    }
+    out += "constexpr BakedMelTable kMelTables[] = {\n" + tables + "};\n\n";
+
+    DctPlan dct(defaults.numBands, defaults.numCoeffs);
+    appendf(out, "constexpr int kDctInputs = %d;\n", defaults.numBands);
+    appendf(out, "constexpr int kDctCoeffs = %d;\n", defaults.numCoeffs);
+    appendFloats(out, "kDctBasis", dct.getBasis().data(), dct.getBasis().size());
+
+    out += "}  // namespace default_tables\n";
+    return out;
+}
+
+bool readFile(const char* path, std::string& contents) {
+    FILE* file = std::fopen(path, "rb");
+    if (!file) return false;
+    char buffer[1 << 16];
+    size_t got;
+    while ((got = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        contents.append(buffer, got);
+    }
+    std::fclose(file);
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    bool check = argc == 3 && std::strcmp(argv[1], "--check") == 0;
+    if (argc != 2 && !check) {
+        std::fprintf(stderr, "Usage: gen_default_tables output.h | --check existing.h\n");
+        return 2;
+    }
+
+    std::string tables = generate();
+    if (check) {
+        std::string existing;
+        if (!readFile(argv[2], existing) || existing != tables) {
+            std::fprintf(stderr, "%s is stale, rebuild the regenerate_default_tables target\n", argv[2]);
+            return 1;
+        }
+        return 0;
+    }
+
+    FILE* out = std::fopen(argv[1], "wb");
+    if (!out || std::fwrite(tables.data(), 1, tables.size(), out) != tables.size()) {
+        std::fprintf(stderr, "Cannot write %s\n", argv[1]);
+        if (out) std::fclose(out);
+        return 1;
+    }
+    std::fclose(out);
+    return 0;
+}
@@ -0,0 +1,390 @@
+// Native MFCC extractor for server-side feature extraction.
+// Runs the same SignalProcessor core as the WASM module over PCM files.
+//
+// Usage: mfcc_extract [options] input output
+//   input is a WAV file (16-bit PCM or float32, downmixed to mono) or raw
+//   mono little-endian PCM, output is numFrames x width rows, width =
+//   numCoeffs * (1 + deltas), as raw float32, text or a feature file.
+//   Input is read and features are written block by block, so memory use is
+//   bounded whatever the input length.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "signal_processor.h"
+#include "feature_file.h"
+#include "pcm_reader.h"
+
+namespace {
+
+void printUsage() {
+    std::fprintf(stderr,
+        "Usage: mfcc_extract [options] input output\n"
+        "  --sample-rate HZ   sample rate of raw input (default 44100, WAV files use their header)\n"
+        "  --raw FORMAT       raw input samples: f32 | s16 (default f32)\n"
+        "  --frame N          frame length in samples (default 1024)\n"
+        "  --fft N            FFT size (default: frame length rounded up to a power of 2)\n"
+        "  --hop N            hop between frames (default frame/2)\n"
+        "  --bands N          mel bands (default 40)\n"
+        "  --coeffs N         cepstral coefficients (default 13)\n"
+        "  --fmin HZ          lowest mel edge (default 20)\n"
+        "  --fmax HZ          highest mel edge (default sample-rate/2)\n"
+        "  --window NAME      hamming | hann | blackman | povey (default hamming)\n"
+        "  --deltas N         0 static only, 1 add deltas, 2 add delta-deltas (default 0)\n"
+        "  --delta-window N   delta regression half-width in frames (default 2)\n"
+        "  --threads N        worker threads, 0 = all cores (default 0)\n"
+        "  --format FORMAT    raw | csv | f32 | f16 | u8 (default raw)\n"
+        "                     raw: float32 rows, csv: text, f32/f16/u8: feature file\n"
+        "  --csv              same as --format csv\n"
+        "  --decode           input is a feature file, convert it to --format\n");
+}
+
+bool parseWindow(const char* name, WindowType& type) {
+    if (std::strcmp(name, "hamming") == 0) type = WindowType::Hamming;
+    else if (std::strcmp(name, "hann") == 0) type = WindowType::Hann;
+    else if (std::strcmp(name, "blackman") == 0) type = WindowType::Blackman;
+    else if (std::strcmp(name, "povey") == 0) type = WindowType::Povey;
+    else return false;
+    return true;
+}
+
+enum class OutputFormat {
+    Raw,
+    Csv,
+    FeatureFile32,
+    FeatureFile16,
+    FeatureFile8,
+};
+
+bool parseFormat(const char* name, OutputFormat& format) {
+    if (std::strcmp(name, "raw") == 0) format = OutputFormat::Raw;
+    else if (std::strcmp(name, "csv") == 0) format = OutputFormat::Csv;
+    else if (std::strcmp(name, "f32") == 0) format = OutputFormat::FeatureFile32;
+    else if (std::strcmp(name, "f16") == 0) format = OutputFormat::FeatureFile16;
+    else if (std::strcmp(name, "u8") == 0) format = OutputFormat::FeatureFile8;
+    else return false;
+    return true;
+}
+
+// Destination for finished rows in any of the output formats
+class FeatureSink {
+public:
+    ~FeatureSink() {
+        if (file) std::fclose(file);
+    }
+
+    bool open(const char* path, OutputFormat outputFormat, const ProcessorConfig& config) {
+        format = outputFormat;
+        width = outputWidth(config);
+        if (format != OutputFormat::Raw && format != OutputFormat::Csv) {
+            feature_file::Encoding encoding = format == OutputFormat::FeatureFile16 ? feature_file::Encoding::Float16
+                : format == OutputFormat::FeatureFile8 ? feature_file::Encoding::Uint8
+                : feature_file::Encoding::Float32;
+            return writer.open(path, feature_file::makeHeader(config, encoding));
+        }
+        file = std::fopen(path, format == OutputFormat::Csv ? "w" : "wb");
+        return file != nullptr;
+    }
+
+    bool write(const float* rows, int numRows) {
+        switch (format) {
+            case OutputFormat::Raw: {
+                size_t count = static_cast<size_t>(numRows) * width;
+                return std::fwrite(rows, sizeof(float), count, file) == count;
+            }
+            case OutputFormat::Csv:
+                for (int f = 0; f < numRows; f++) {
+                    for (int k = 0; k < width; k++) {
+                        // %.9g round-trips float32 exactly
+                        std::fprintf(file, k == 0 ? "%.9g" : ",%.9g", rows[static_cast<size_t>(f) * width + k]);
+                    }
+                    std::fputc('\n', file);
+                }
+                return !std::ferror(file);
+            default:
+                return writer.write(rows, numRows);
+        }
+    }
+
+    bool finish() {
+        if (!file) return writer.close();
+        bool ok = std::fclose(file) == 0;
+        file = nullptr;
+        return ok;
+    }
+
+private:
+    OutputFormat format = OutputFormat::Raw;
+    int width = 0;
+    FILE* file = nullptr;
+    feature_file::FileWriter writer;
+};
+
+// Frames per processBatch call; with the sample block this bounds memory at
+// roughly kBlockFrames * (hop + width) floats
+constexpr int kBlockFrames = 4096;
+
+// Computes every frame of the input block by block. processor runs statics
+// only (deltaOrder 0); `shape` is the full sanitized config. Statics match a
+// single processBatch over the whole input. Deltas are exact as well: each
+// block keeps 2 * delay rows of context, and a row is only written once the
+// delay rows after it exist (or the input has ended). Returns frames written,
+// -1 if the output failed.
+long long extractFeatures(PcmReader& reader, SignalProcessor& processor,
+                          const ProcessorConfig& shape, FeatureSink& sink) {
+    int numCoeffs = shape.numCoeffs;
+    int width = outputWidth(shape);
+    int context = shape.deltaOrder * shape.deltaWindow;
+    int hop = shape.hopLength;
+
+    std::vector<float> samples(static_cast<size_t>(kBlockFrames - 1) * hop + shape.frameLength);
+    std::vector<float> statics(static_cast<size_t>(kBlockFrames) * numCoeffs);
+    std::vector<float> rows(static_cast<size_t>(2 * context + kBlockFrames) * width);
+    size_t filled = 0;
+    int numRows = 0;   // rows held, context included
+    int pending = 0;   // first row not written yet
+    long long written = 0;
+    bool ended = false;
+
+    while (true) {
+        while (!ended && filled < samples.size()) {
+            size_t n = reader.read(samples.data() + filled, samples.size() - filled);
+            if (n == 0) ended = true;
+            filled += n;
+        }
+
+        int frames = filled < static_cast<size_t>(shape.frameLength)
+            ? 0
+            : static_cast<int>((filled - shape.frameLength) / hop) + 1;
+        if (frames > 0) {
+            processor.processBatch(samples.data(), frames, hop, statics.data());
+            for (int f = 0; f < frames; f++) {
+                std::copy(statics.begin() + static_cast<size_t>(f) * numCoeffs,
+                          statics.begin() + static_cast<size_t>(f + 1) * numCoeffs,
+                          rows.begin() + static_cast<size_t>(numRows + f) * width);
+            }
+            numRows += frames;
+            size_t consumed = static_cast<size_t>(frames) * hop;
+            std::copy(samples.begin() + consumed, samples.begin() + filled, samples.begin());
+            filled -= consumed;
+        }
+
+        if (context > 0) DeltaStage::applyAligned(shape, rows.data(), numRows);
+
+        int ready = ended ? numRows : numRows - context;
+        if (ready > pending) {
+            if (!sink.write(rows.data() + static_cast<size_t>(pending) * width, ready - pending)) return -1;
+            written += ready - pending;
+            pending = ready;
+        }
+        if (ended) return written;
+
+        // Keep the unwritten rows and the context left of them
+        int keep = std::min(numRows, 2 * context);
+        int drop = numRows - keep;
+        std::copy(rows.begin() + static_cast<size_t>(drop) * width,
+                  rows.begin() + static_cast<size_t>(numRows) * width, rows.begin());
+        numRows = keep;
+        pending -= drop;
+    }
+}
+
+// Feature file input for --decode: the header, quantization and index are
+// read up front, then the blocks one at a time
+class FeatureFileInput {
+public:
+    ~FeatureFileInput() {
+        if (file) std::fclose(file);
+    }
+
+    // Fills shape from the header; false with error set on failure
+    bool open(const char* path, ProcessorConfig& shape, std::string& error) {
+        file = std::fopen(path, "rb");
+        if (!file) {
+            error = std::string("Cannot read ") + path;
+            return false;
+        }
+        error = "Not a valid feature file";
+        std::vector<uint8_t> prefix(sizeof(feature_file::Header));
+        prefix.resize(std::fread(prefix.data(), 1, prefix.size(), file));
+        feature_file::Header header;
+        if (!feature_file::parseHeader(prefix.data(), prefix.size(), header)) return false;
+        // The index runs to the end of the file, which bounds numBlocks
+        // before anything is allocated
+        if (std::fseek(file, 0, SEEK_END) != 0) return false;
+        long fileSize = std::ftell(file);
+        if (fileSize < 0 || header.indexOffset > static_cast<uint64_t>(fileSize) ||
+            header.numBlocks > (static_cast<uint64_t>(fileSize) - header.indexOffset) / sizeof(feature_file::IndexEntry)) {
+            return false;
+        }
+        std::vector<uint8_t> index(header.numBlocks * sizeof(feature_file::IndexEntry));
+        if (std::fseek(file, static_cast<long>(header.indexOffset), SEEK_SET) != 0 ||
+            std::fread(index.data(), 1, index.size(), file) != index.size()) {
+            return false;
+        }
+        if (!reader.load(prefix.data(), prefix.size(), index.data(), index.size())) return false;
+        for (int b = 0; b < reader.getNumBlocks(); b++) {
+            if (!reader.blockFits(b, static_cast<uint64_t>(fileSize))) return false;
+        }
+
+        shape.numCoeffs = static_cast<int>(header.numCoeffs);
+        shape.deltaOrder = static_cast<int>(header.deltaOrder);
+        shape.sampleRate = header.sampleRate;
+        shape.frameLength = static_cast<int>(header.frameLength);
+        shape.hopLength = static_cast<int>(header.hopLength);
+        return outputWidth(shape) == static_cast<int>(header.width);
+    }
+
+    // Decodes every block into sink; returns frames written, -1 on failure
+    long long decodeTo(FeatureSink& sink) {
+        const feature_file::Header& header = reader.getHeader();
+        std::vector<uint8_t> block;
+        std::vector<float> rows;
+        long long written = 0;
+        for (int b = 0; b < reader.getNumBlocks(); b++) {
+            int frames = reader.getBlockFrames(b);
+            block.resize(feature_file::blockBytes(header, frames));
+            rows.resize(static_cast<size_t>(frames) * header.width);
+            if (std::fseek(file, static_cast<long>(reader.getBlockOffset(b)), SEEK_SET) != 0 ||
+                std::fread(block.data(), 1, block.size(), file) != block.size()) {
+                return -1;
+            }
+            reader.decode(block.data(), 0, frames, rows.data());
+            if (!sink.write(rows.data(), frames)) return -1;
+            written += frames;
+        }
+        return written;
+    }
+
+private:
+    FILE* file = nullptr;
+    feature_file::Reader reader;
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    ProcessorConfig config;
+    config.fftSize = 0;      // derived from the frame length unless given
+    config.hopLength = 0;    // frameLength / 2 unless given
+    int threads = 0;
+    OutputFormat format = OutputFormat::Raw;
+    bool decode = false;
+    PcmReader::Encoding rawEncoding = PcmReader::Encoding::Float32;
+    std::vector<const char*> positional;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--csv") {
+            format = OutputFormat::Csv;
+        } else if (arg == "--decode") {
+            decode = true;
+        } else if (arg == "--help" || arg == "-h") {
+            printUsage();
+            return 0;
+        } else if (arg.rfind("--", 0) == 0 && hasValue) {
+            const char* value = argv[++i];
+            if (arg == "--sample-rate") config.sampleRate = std::atof(value);
+            else if (arg == "--frame") config.frameLength = std::atoi(value);
+            else if (arg == "--fft") config.fftSize = std::atoi(value);
+            else if (arg == "--hop") config.hopLength = std::atoi(value);
+            else if (arg == "--bands") config.numBands = std::atoi(value);
+            else if (arg == "--coeffs") config.numCoeffs = std::atoi(value);
+            else if (arg == "--fmin") config.fMin = std::atof(value);
+            else if (arg == "--fmax") config.fMax = std::atof(value);
+            else if (arg == "--deltas") config.deltaOrder = std::atoi(value);
+            else if (arg == "--delta-window") config.deltaWindow = std::atoi(value);
+            else if (arg == "--threads") threads = std::atoi(value);
+            else if (arg == "--format") {
+                if (!parseFormat(value, format)) {
+                    std::fprintf(stderr, "Unknown format: %s\n", value);
+                    return 1;
+                }
+            } else if (arg == "--raw") {
+                if (std::strcmp(value, "f32") == 0) rawEncoding = PcmReader::Encoding::Float32;
+                else if (std::strcmp(value, "s16") == 0) rawEncoding = PcmReader::Encoding::Int16;
+                else {
+                    std::fprintf(stderr, "Unknown raw format: %s\n", value);
+                    return 1;
+                }
+            } else if (arg == "--window") {
+                if (!parseWindow(value, config.windowType)) {
+                    std::fprintf(stderr, "Unknown window: %s\n", value);
+                    return 1;
+                }
+            } else {
+                std::fprintf(stderr, "Unknown option: %s\n", arg.c_str());
+                printUsage();
+                return 1;
+            }
+        } else if (arg.rfind("--", 0) == 0) {
+            std::fprintf(stderr, "Missing value for %s\n", arg.c_str());
+            return 1;
+        } else {
+            positional.push_back(argv[i]);
+        }
+    }
+
+    if (positional.size() != 2) {
+        printUsage();
+        return 1;
+    }
+
+    std::string error;
+    if (decode) {
+        FeatureFileInput input;
+        ProcessorConfig shape;
+        FeatureSink sink;
+        if (!input.open(positional[0], shape, error)) {
+            std::fprintf(stderr, "%s: %s\n", positional[0], error.c_str());
+            return 1;
+        }
+        if (!sink.open(positional[1], format, shape)) {
+            std::fprintf(stderr, "Cannot write %s\n", positional[1]);
+            return 1;
+        }
+        long long numFrames = input.decodeTo(sink);
+        if (numFrames < 0 || !sink.finish()) {
+            std::fprintf(stderr, "Failed converting %s\n", positional[0]);
+            return 1;
+        }
+        std::fprintf(stderr, "%lld frames x %d values\n", numFrames, outputWidth(shape));
+        return 0;
+    }
+
+    PcmReader reader;
+    if (!reader.open(positional[0], rawEncoding, error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+    if (reader.isWav()) config.sampleRate = reader.getSampleRate();
+
+    // The processor computes statics only; deltas are added per block
+    ProcessorConfig shape = sanitizeConfig(config);
+    ProcessorConfig staticConfig = shape;
+    staticConfig.deltaOrder = 0;
+    SignalProcessor processor(staticConfig);
+    processor.setNumThreads(threads > 0 ? threads : static_cast<int>(std::thread::hardware_concurrency()));
+    int width = outputWidth(shape);
+
+    FeatureSink sink;
+    if (!sink.open(positional[1], format, shape)) {
+        std::fprintf(stderr, "Cannot write %s\n", positional[1]);
+        return 1;
+    }
+    long long numFrames = extractFeatures(reader, processor, shape, sink);
+    if (numFrames < 0 || !sink.finish()) {
+        std::fprintf(stderr, "Failed writing %s\n", positional[1]);
+        return 1;
+    }
+
+    std::fprintf(stderr, "%lld frames x %d values (%d Hz, frame %d, hop %d, fft %d, %d bands)\n",
+                 numFrames, width, static_cast<int>(shape.sampleRate), shape.frameLength,
+                 shape.hopLength, shape.fftSize, shape.numBands);
+    return 0;
+}
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Streams mono float samples from a WAV file (16-bit PCM or 32-bit float,
+// any channel count, averaged down to mono) or from a headerless raw file.
+// The file is read and converted one fixed-size block at a time, so memory
+// use does not depend on the input length. Assumes a little-endian host, like
+// the rest of the native tools.
+class PcmReader {
+public:
+    enum class Encoding {
+        Float32,
+        Int16,
+    };
+
+    static constexpr size_t kBlockBytes = 1 << 16;
+
+    PcmReader() : bytes(kBlockBytes) {}
+    ~PcmReader() {
+        if (file) std::fclose(file);
+    }
+    PcmReader(const PcmReader&) = delete;
+    PcmReader& operator=(const PcmReader&) = delete;
+
+    // Opens path as WAV when it starts with a RIFF/WAVE header, otherwise as
+    // raw mono samples in rawEncoding. On failure returns false and sets error.
+    bool open(const char* path, Encoding rawEncoding, std::string& error) {
+        file = std::fopen(path, "rb");
+        if (!file) {
+            error = std::string("Cannot read ") + path;
+            return false;
+        }
+        unsigned char riff[12];
+        if (std::fread(riff, 1, sizeof(riff), file) == sizeof(riff) &&
+            std::memcmp(riff, "RIFF", 4) == 0 && std::memcmp(riff + 8, "WAVE", 4) == 0) {
+            wav = true;
+            return parseWavChunks(error);
+        }
+        std::rewind(file);
+        encoding = rawEncoding;
+        return true;
+    }
+
+    bool isWav() const { return wav; }
+    // From the WAV header, 0 for raw input
+    float getSampleRate() const { return sampleRate; }
+    int getChannels() const { return channels; }
+
+    // Reads up to maxSamples mono samples into out; returns 0 at the end
+    size_t read(float* out, size_t maxSamples) {
+        size_t frameBytes = static_cast<size_t>(channels) * bytesPerSample();
+        size_t total = 0;
+        while (total < maxSamples) {
+            size_t wanted = std::min((maxSamples - total) * frameBytes, bytes.size() / frameBytes * frameBytes);
+            if (dataBytesLeft < wanted) wanted = static_cast<size_t>(dataBytesLeft) / frameBytes * frameBytes;
+            if (wanted == 0) break;
+            size_t got = std::fread(bytes.data(), 1, wanted, file) / frameBytes;
+            if (got == 0) break;
+            dataBytesLeft -= got * frameBytes;
+            convert(bytes.data(), got, out + total);
+            total += got;
+        }
+        return total;
+    }
+
+private:
+    FILE* file = nullptr;
+    bool wav = false;
+    Encoding encoding = Encoding::Float32;
+    int channels = 1;
+    float sampleRate = 0.0f;
+    uint64_t dataBytesLeft = UINT64_MAX;  // raw input runs to the end of the file
+    std::vector<unsigned char> bytes;     // one block of undecoded input
+
+    static uint16_t u16(const unsigned char* p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+    static uint32_t u32(const unsigned char* p) {
+        return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+               (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    }
+
+    size_t bytesPerSample() const { return encoding == Encoding::Int16 ? 2 : 4; }
+
+    // Walks the chunks up to "data", which is left as the read position
+    bool parseWavChunks(std::string& error) {
+        bool haveFormat = false;
+        unsigned char chunk[8];
+        while (std::fread(chunk, 1, sizeof(chunk), file) == sizeof(chunk)) {
+            uint32_t size = u32(chunk + 4);
+            if (std::memcmp(chunk, "fmt ", 4) == 0) {
+                unsigned char fmt[40] = {};
+                size_t used = std::min<size_t>(size, sizeof(fmt));
+                if (size < 16 || std::fread(fmt, 1, used, file) != used) {
+                    error = "Truncated WAV fmt chunk";
+                    return false;
+                }
+                uint16_t tag = u16(fmt);
+                channels = u16(fmt + 2);
+                sampleRate = static_cast<float>(u32(fmt + 4));
+                uint16_t bits = u16(fmt + 14);
+                // WAVE_FORMAT_EXTENSIBLE keeps the real tag in the subformat GUID
+                if (tag == 0xFFFE && used >= 26) tag = u16(fmt + 24);
+                if (tag == 1 && bits == 16) {
+                    encoding = Encoding::Int16;
+                } else if (tag == 3 && bits == 32) {
+                    encoding = Encoding::Float32;
+                } else {
+                    error = "Unsupported WAV encoding (need 16-bit PCM or 32-bit float)";
+                    return false;
+                }
+                if (channels < 1) {
+                    error = "WAV file has no channels";
+                    return false;
+                }
+                haveFormat = true;
+                if (!skip(size - used + (size & 1))) break;
+            } else if (std::memcmp(chunk, "data", 4) == 0) {
+                if (!haveFormat) {
+                    error = "WAV data chunk before fmt chunk";
+                    return false;
+                }
+                // Streaming and >4 GB writers leave the size at 0xFFFFFFFF
+                dataBytesLeft = size == 0xFFFFFFFFu ? UINT64_MAX : size;
+                return true;
+            } else if (!skip(static_cast<uint64_t>(size) + (size & 1))) {
+                break;
+            }
+        }
+        error = "WAV file has no data chunk";
+        return false;
+    }
+
+    bool skip(uint64_t size) {
+        return size == 0 || std::fseek(file, static_cast<long>(size), SEEK_CUR) == 0;
+    }
+
+    void convert(const unsigned char* in, size_t numFrames, float* out) const {
+        float gain = 1.0f / channels;
+        for (size_t f = 0; f < numFrames; f++) {
+            float sum = 0.0f;
+            for (int c = 0; c < channels; c++) {
+                if (encoding == Encoding::Int16) {
+                    sum += static_cast<int16_t>(u16(in)) * (1.0f / 32768.0f);
+                    in += 2;
+                } else {
+                    float value;
+                    std::memcpy(&value, in, sizeof(value));
+                    sum += value;
+                    in += 4;
+                }
+            }
+            out[f] = channels == 1 ? sum : sum * gain;
+        }
+    }
+};
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "simd_kernels.h"
+
+enum class NormalizationMode {
+    FixedRange,  // per-coefficient scale/offset set by the caller
+    Cmvn,        // running mean/variance, maps +-zRange standard deviations onto the range
+    MinMax       // per-coefficient running min/max that relax towards the signal
+};
+
+// Post-DCT stage that maps coefficients to display units in [minValue, maxValue].
+// Every mode reduces to a per-coefficient scale/offset followed by one
+// vectorized affine+clamp pass; the adaptive modes only update their
+// statistics and re-derive scale/offset each frame.
+class Normalizer {
+public:
+    explicit Normalizer(int numCoeffs)
+        : numCoeffs(numCoeffs),
+          fixedScale(numCoeffs, 1.0f),
+          fixedOffset(numCoeffs, 0.0f),
+          scale(numCoeffs, 1.0f),
+          offset(numCoeffs, 0.0f),
+          mean(numCoeffs, 0.0f),
+          variance(numCoeffs, 1.0f),
+          low(numCoeffs, 0.0f),
+          high(numCoeffs, 0.0f) {}
+
+    NormalizationMode getMode() const { return mode; }
+    void setMode(NormalizationMode newMode) {
+        mode = newMode;
+        reset();
+    }
+
+    // FixedRange: display = coefficient * coeffScale + coeffOffset
+    void setFixedMapping(int coeff, float coeffScale, float coeffOffset) {
+        if (coeff < 0 || coeff >= numCoeffs) return;
+        fixedScale[coeff] = coeffScale;
+        fixedOffset[coeff] = coeffOffset;
+    }
+
+    void setRange(float minDisplay, float maxDisplay) {
+        minValue = minDisplay;
+        maxValue = maxDisplay;
+    }
+    float getMinValue() const { return minValue; }
+    float getMaxValue() const { return maxValue; }
+
+    // Per-frame weight of the newest frame in the running statistics (0-1).
+    // 0.01 is a time constant of about 100 frames.
+    void setDecay(float newDecay) { decay = std::min(std::max(newDecay, 0.0f), 1.0f); }
+    float getDecay() const { return decay; }
+
+    // Cmvn: number of standard deviations either side of the mean that map to
+    // the ends of the display range
+    void setZRange(float range) { zRange = std::max(range, 1e-3f); }
+
+    // Forgets the running statistics; the next frame re-seeds them
+    void reset() { framesSeen = 0; }
+
+    // Normalizes numCoeffs values from coeffs into out
+    void apply(const float* coeffs, float* out) {
+        switch (mode) {
+            case NormalizationMode::FixedRange:
+                kernels::affineClamp(coeffs, fixedScale.data(), fixedOffset.data(),
+                                     minValue, maxValue, out, numCoeffs);
+                return;
+            case NormalizationMode::Cmvn:
+                updateCmvn(coeffs);
+                break;
+            case NormalizationMode::MinMax:
+                updateMinMax(coeffs);
+                break;
+        }
+        framesSeen++;
+        kernels::affineClamp(coeffs, scale.data(), offset.data(), minValue, maxValue, out, numCoeffs);
+    }
+
+private:
+    int numCoeffs;
+    NormalizationMode mode = NormalizationMode::FixedRange;
+    std::vector<float> fixedScale;
+    std::vector<float> fixedOffset;
+    std::vector<float> scale;   // derived each frame by the adaptive modes
+    std::vector<float> offset;
+    std::vector<float> mean;
+    std::vector<float> variance;
+    std::vector<float> low;
+    std::vector<float> high;
+    float minValue = 0.0f;
+    float maxValue = 100.0f;
+    float decay = 0.01f;
+    float zRange = 3.0f;
+    int framesSeen = 0;
+
+    static constexpr float kEpsilon = 1e-6f;
+
+    // Exponentially weighted mean/variance:
+    // mean += a (x - mean), var = (1 - a) (var + a (x - mean)²)
+    void updateCmvn(const float* x) {
+        float mid = 0.5f * (minValue + maxValue);
+        float halfSpan = 0.5f * (maxValue - minValue);
+        for (int k = 0; k < numCoeffs; k++) {
+            if (framesSeen == 0) {
+                mean[k] = x[k];
+                variance[k] = 1.0f;
+            } else {
+                float d = x[k] - mean[k];
+                mean[k] += decay * d;
+                variance[k] = (1.0f - decay) * (variance[k] + decay * d * d);
+            }
+            scale[k] = halfSpan / (zRange * std::sqrt(variance[k] + kEpsilon));
+            offset[k] = mid - mean[k] * scale[k];
+        }
+    }
+
+    // Bounds snap outwards to new extremes and otherwise drift inwards by
+    // decay of the gap to the current value
+    void updateMinMax(const float* x) {
+        float span = maxValue - minValue;
+        for (int k = 0; k < numCoeffs; k++) {
+            if (framesSeen == 0) {
+                low[k] = x[k];
+                high[k] = x[k];
+            } else {
+                low[k] = x[k] < low[k] ? x[k] : low[k] + decay * (x[k] - low[k]);
+                high[k] = x[k] > high[k] ? x[k] : high[k] + decay * (x[k] - high[k]);
+            }
+            float width = std::max(high[k] - low[k], kEpsilon);
+            scale[k] = span / width;
+            offset[k] = minValue - low[k] * scale[k];
+        }
+    }
+};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+
+// Hot-path counters and timers of one SignalProcessor. Kept as a flat double
+// array so JS can read all of them through a single Float64Array view; the
+// field order is mirrored in src/perfStats.js. Stage times are cumulative
+// milliseconds, divide by Frames for a per-frame average.
+struct PerfStats {
+    enum Field {
+        Frames,          // frames computed while instrumentation was enabled
+        FftMs,           // window + FFT (the window is fused into the FFT load)
+        PowerMs,
+        MelMs,
+        LogMs,
+        DctMs,
+        TotalMs,         // whole frame, including the stages above
+        MaxFrameMs,      // slowest single frame
+        LastFrameMs,
+        DroppedFrames,   // stream frames dropped because a push produced too many
+        kNumFields
+    };
+
+    double values[kNumFields] = {};
+
+    void reset() { std::fill(values, values + kNumFields, 0.0); }
+
+    void addFrame(double frameMs) {
+        values[Frames] += 1.0;
+        values[TotalMs] += frameMs;
+        values[LastFrameMs] = frameMs;
+        values[MaxFrameMs] = std::max(values[MaxFrameMs], frameMs);
+    }
+
+    // Adds the counters of another set (a batch worker's): sums, the larger
+    // max, and its last frame if it recorded any
+    void merge(const PerfStats& other) {
+        for (int field : {Frames, FftMs, PowerMs, MelMs, LogMs, DctMs, TotalMs, DroppedFrames}) {
+            values[field] += other.values[field];
+        }
+        values[MaxFrameMs] = std::max(values[MaxFrameMs], other.values[MaxFrameMs]);
+        if (other.values[Frames] > 0) values[LastFrameMs] = other.values[LastFrameMs];
+    }
+};
+
+// Millisecond stopwatch for the instrumented path. steady_clock maps to
+// performance.now() under Emscripten, whose resolution browsers coarsen
+// (a few microseconds on cross-origin isolated pages), so single stage
+// readings are noisy but the cumulative sums average out.
+class StageClock {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // A clock constructed with running = false never reads the time, so the
+    // uninstrumented path pays nothing
+    explicit StageClock(bool running = true)
+        : start(running ? Clock::now() : Clock::time_point()), last(start) {}
+
+    // Milliseconds since construction or the previous lap
+    double lap() {
+        Clock::time_point now = Clock::now();
+        double ms = std::chrono::duration<double, std::milli>(now - last).count();
+        last = now;
+        return ms;
+    }
+
+    // Milliseconds from construction to the last lap
+    double total() const { return std::chrono::duration<double, std::milli>(last - start).count(); }
+
+private:
+    Clock::time_point start;
+    Clock::time_point last;
+};
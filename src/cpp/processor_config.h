@@ -0,0 +1,105 @@
+#pragma once
+
+#include <algorithm>
+
+enum class WindowType {
+    Hamming,
+    Hann,
+    Blackman,
+    Povey,
+};
+
+// How streamed frames get their spectrum
+enum class SpectrumEngine {
+    Fft,         // windowed real FFT of every frame
+    SlidingDft,  // per-sample sliding DFT with periodic FFT resyncs, streaming only
+};
+
+// Shape of one MFCC pipeline. All tables (FFT plan, window, filterbank, DCT
+// basis) are built for exactly this shape when a SignalProcessor is created.
+struct ProcessorConfig {
+    float sampleRate = 44100.0f;
+    int frameLength = 1024;   // samples analysed per frame
+    int fftSize = 1024;       // power of 2 >= frameLength, frames are zero-padded
+    int hopLength = 512;      // samples between streamed frames, <= 0 means frameLength/2
+    int numBands = 40;        // mel bands
+    int numCoeffs = 13;       // cepstral coefficients kept after the DCT
+    float fMin = 20.0f;       // lowest mel band edge in Hz
+    float fMax = 0.0f;        // highest mel band edge in Hz, <= 0 means sampleRate/2
+    WindowType windowType = WindowType::Hamming;
+    int deltaOrder = 0;       // 0 = static only, 1 adds deltas, 2 adds delta-deltas
+    int deltaWindow = 2;      // regression half-width N in frames
+    // SlidingDft only takes effect for small hops, see slidingDftMaxHop()
+    SpectrumEngine spectrumEngine = SpectrumEngine::Fft;
+    int slidingDftResync = 16; // streamed frames between exact FFT resyncs of the sliding DFT
+};
+
+// Floats per output frame: numCoeffs statics, then numCoeffs per delta order
+inline int outputWidth(const ProcessorConfig& config) {
+    return config.numCoeffs * (1 + config.deltaOrder);
+}
+
+// Helper to find next power of 2
+inline int nextPowerOf2(int n) {
+    int power = 1;
+    while (power < n) {
+        power *= 2;
+    }
+    return power;
+}
+
+// Cosine terms of the window past the constant, 0 when it is not a cosine sum
+inline int slidingDftCosineTerms(WindowType type) {
+    switch (type) {
+        case WindowType::Hamming:
+        case WindowType::Hann:
+            return 1;
+        case WindowType::Blackman:
+            return 2;
+        case WindowType::Povey:
+            break;
+    }
+    return 0;
+}
+
+// Largest hop at which the sliding DFT is expected to beat one real FFT per
+// frame; 0 means it never pays off. Every sample updates fftSize/2+1 bins plus
+// fftSize per cosine term at ~8 flops each, against about 5 (n/2) log2(n/2)
+// flops for the packed n/2-point FFT, its split and the windowed pack, which
+// allows about 2 samples for Hann/Hamming and 1 for Blackman. The model assumes the
+// update runs as wide as the FFT butterflies (the SIMD build); the scalar
+// native build measures its crossover below one sample (mfcc_bench
+// "spectrumNsPerFrame"), so there it stays slower than the FFT even at hop 1.
+inline int slidingDftMaxHop(const ProcessorConfig& config) {
+    int terms = slidingDftCosineTerms(config.windowType);
+    if (terms == 0) return 0;
+    int n = config.fftSize;
+    int log2Half = 0;
+    while ((2 << log2Half) < n) log2Half++;
+    double fftFlops = 5.0 * (n / 2) * log2Half + 8.0 * n;
+    double slideFlopsPerSample = 8.0 * (n / 2 + 1 + terms * n);
+    return static_cast<int>(fftFlops / slideFlopsPerSample);
+}
+
+// Clamps a user supplied config into a shape the pipeline can run
+inline ProcessorConfig sanitizeConfig(ProcessorConfig config) {
+    if (config.sampleRate <= 0.0f) config.sampleRate = 44100.0f;
+    config.frameLength = std::max(2, config.frameLength);
+    config.fftSize = nextPowerOf2(std::max(config.fftSize, config.frameLength));
+    if (config.hopLength <= 0) config.hopLength = config.frameLength / 2;
+    config.hopLength = std::min(config.hopLength, config.frameLength);
+    config.numBands = std::max(1, config.numBands);
+    config.numCoeffs = std::max(1, std::min(config.numCoeffs, config.numBands));
+
+    float nyquist = config.sampleRate / 2;
+    if (config.fMax <= 0.0f || config.fMax > nyquist) config.fMax = nyquist;
+    config.fMin = std::max(0.0f, std::min(config.fMin, config.fMax));
+    config.deltaOrder = std::max(0, std::min(config.deltaOrder, 2));
+    config.deltaWindow = std::max(1, std::min(config.deltaWindow, 8));
+    // The sliding DFT is kept only where it is cheaper than the FFT
+    if (config.hopLength > slidingDftMaxHop(config)) {
+        config.spectrumEngine = SpectrumEngine::Fft;
+    }
+    config.slidingDftResync = std::max(1, config.slidingDftResync);
+    return config;
+}
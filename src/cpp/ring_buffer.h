@@ -0,0 +1,49 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+// Fixed-capacity sample history for the streaming frame engine.
+// Writes overwrite the oldest samples; copyLatest() linearizes the most recent
+// samples oldest-first so they can be fed to the frame pipeline.
+class SampleRingBuffer {
+public:
+    explicit SampleRingBuffer(int capacity) : buffer(capacity, 0.0f) {}
+
+    int capacity() const { return static_cast<int>(buffer.size()); }
+    int size() const { return filled; }
+
+    void clear() {
+        writePos = 0;
+        filled = 0;
+        std::fill(buffer.begin(), buffer.end(), 0.0f);
+    }
+
+    void write(const float* samples, int n) {
+        int cap = capacity();
+        // Only the newest `cap` samples can survive the write
+        if (n > cap) {
+            samples += n - cap;
+            n = cap;
+        }
+        int first = std::min(n, cap - writePos);
+        std::copy(samples, samples + first, buffer.begin() + writePos);
+        std::copy(samples + first, samples + n, buffer.begin());
+        writePos = (writePos + n) % cap;
+        filled = std::min(cap, filled + n);
+    }
+
+    // Copies the newest n samples (n <= size()) into out, oldest first
+    void copyLatest(float* out, int n) const {
+        int cap = capacity();
+        int start = (writePos - n + cap) % cap;
+        int first = std::min(n, cap - start);
+        std::copy(buffer.begin() + start, buffer.begin() + start + first, out);
+        std::copy(buffer.begin(), buffer.begin() + (n - first), out + first);
+    }
+
+private:
+    std::vector<float> buffer;
+    int writePos = 0;
+    int filled = 0;
+};
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+#include "processor_config.h"
+
+// Bump allocator over one aligned block, sized once up front.
+// Buffers carved from it live as long as the arena and are never freed
+// individually, so the per-frame path never reaches malloc.
+class ScratchArena {
+public:
+    static constexpr size_t kAlignment = 16;  // one v128 / SSE register
+
+    static constexpr size_t alignUp(size_t bytes) {
+        return (bytes + kAlignment - 1) & ~(kAlignment - 1);
+    }
+
+    template <typename T>
+    static constexpr size_t bytesFor(size_t count) {
+        return alignUp(count * sizeof(T));
+    }
+
+    explicit ScratchArena(size_t capacityBytes)
+        : block(static_cast<unsigned char*>(::operator new(alignUp(capacityBytes), std::align_val_t(kAlignment)))),
+          capacity(alignUp(capacityBytes)) {}
+
+    size_t getCapacity() const { return capacity; }
+    size_t getUsed() const { return used; }
+
+    // Returns a zero-initialized, kAlignment-aligned array of count elements.
+    // Returns nullptr if the arena was sized too small.
+    template <typename T>
+    T* allocate(size_t count) {
+        size_t bytes = bytesFor<T>(count);
+        if (used + bytes > capacity) return nullptr;
+        unsigned char* p = block.get() + used;
+        used += bytes;
+        T* items = reinterpret_cast<T*>(p);
+        for (size_t i = 0; i < count; i++) {
+            new (items + i) T();
+        }
+        return items;
+    }
+
+private:
+    struct AlignedDelete {
+        void operator()(unsigned char* p) const { ::operator delete(p, std::align_val_t(kAlignment)); }
+    };
+
+    std::unique_ptr<unsigned char, AlignedDelete> block;
+    size_t capacity;
+    size_t used = 0;
+};
+
+// Working buffers for one frame of the pipeline, carved from a single arena.
+// Only trivially destructible types are placed in the arena.
+struct FrameScratch {
+    explicit FrameScratch(const ProcessorConfig& config, size_t dctScratchSize = 0)
+        : arena(ScratchArena::bytesFor<std::complex<float>>(config.fftSize) +
+                ScratchArena::bytesFor<float>(config.fftSize / 2 + 1) +
+                ScratchArena::bytesFor<float>(config.numBands) +
+                ScratchArena::bytesFor<std::complex<float>>(dctScratchSize)),
+          spectrum(arena.allocate<std::complex<float>>(config.fftSize)),
+          power(arena.allocate<float>(config.fftSize / 2 + 1)),
+          mel(arena.allocate<float>(config.numBands)),
+          dct(arena.allocate<std::complex<float>>(dctScratchSize)) {}
+
+    ScratchArena arena;
+    std::complex<float>* spectrum;    // fftSize bins for the complex path, fftSize/2+1 used by the real path
+    float* power;                     // fftSize/2+1
+    float* mel;                       // numBands (log energies after step 5)
+    std::complex<float>* dct;         // FFT-based DCT work area, may be empty
+};
@@ -1,218 +1,202 @@
 #include <emscripten/bind.h>
-#include <vector>
-#include <complex>
-#include <cmath>
-
-class SignalProcessor {
-public:
-    SignalProcessor() {
-        // Initialize mel filterbank
-        initMelFilterbank(2048, 44100, 40);  // 40 mel bands
-    }
-    
-    std::vector<float> processSamples(const std::vector<float>& samples) {
-        // Ensure we have power of 2 size for FFT
-        int fftSize = nextPowerOf2(samples.size());
-        std::vector<float> paddedSamples = samples;
-        paddedSamples.resize(fftSize, 0.0f);  // Zero-padding
-        
-        // Step 1: Apply window function to reduce spectral leakage
-        applyHammingWindow(paddedSamples);
-        
-        // Step 2: Compute FFT - improved implementation
-        auto spectrum = computeFFT(paddedSamples);
-        
-        // Step 3: Get power spectrum (only need first half due to symmetry)
-        auto powerSpectrum = getPowerSpectrum(spectrum);
-        
-        // Step 4: Apply mel filterbank
-        auto melEnergies = applyMelFilterbank(powerSpectrum);
-        
-        // Step 5: Take log (with proper floor value to avoid numerical issues)
-        for (auto& energy : melEnergies) {
-            energy = std::log(std::max(energy, 1e-10f));
-        }
-        
-        // Step 6: Apply DCT to get cepstral coefficients (with proper normalization)
-        return computeDCT(melEnergies);
-    }
-
-private:
-    std::vector<std::vector<float>> melFilterbank;
-    
-    // Helper to find next power of 2
-    int nextPowerOf2(int n) {
-        int power = 1;
-        while (power < n) {
-            power *= 2;
-        }
-        return power;
-    }
-    
-    // Apply Hamming window to reduce spectral leakage
-    void applyHammingWindow(std::vector<float>& samples) {
-        int n = samples.size();
-        for (int i = 0; i < n; i++) {
-            // Hamming window: 0.54 - 0.46 * cos(2πi/(n-1))
-            float window = 0.54f - 0.46f * std::cos(2.0f * M_PI * i / (n - 1));
-            samples[i] *= window;
-        }
-    }
-
-    void initMelFilterbank(int fftSize, float sampleRate, int numBands) {
-        melFilterbank.resize(numBands);
-        
-        // Convert Hz to mel scale
-        auto hzToMel = [](float hz) { return 2595.0f * std::log10(1.0f + hz / 700.0f); };
-        auto melToHz = [](float mel) { return 700.0f * (std::pow(10.0f, mel / 2595.0f) - 1.0f); };
-        
-        float melMax = hzToMel(sampleRate / 2);
-        float melMin = hzToMel(20);  // Start from 20 Hz
-        float melStep = (melMax - melMin) / (numBands + 1);
-        
-        // Only need half of FFT size due to symmetry
-        int filterLength = fftSize / 2 + 1;
-        
-        for (int i = 0; i < numBands; i++) {
-            float melCenter = melMin + (i + 1) * melStep;
-            float melLeft = melMin + i * melStep;
-            float melRight = melMin + (i + 2) * melStep;
-            
-            float hzLeft = melToHz(melLeft);
-            float hzCenter = melToHz(melCenter);
-            float hzRight = melToHz(melRight);
-            
-            int binLeft = static_cast<int>(std::floor(hzLeft * filterLength / (sampleRate/2)));
-            int binCenter = static_cast<int>(std::floor(hzCenter * filterLength / (sampleRate/2)));
-            int binRight = static_cast<int>(std::floor(hzRight * filterLength / (sampleRate/2)));
-            
-            // Ensure bins are within valid range
-            binLeft = std::max(0, std::min(filterLength-1, binLeft));
-            binCenter = std::max(0, std::min(filterLength-1, binCenter));
-            binRight = std::max(0, std::min(filterLength-1, binRight));
-            
-            std::vector<float>& filter = melFilterbank[i];
-            filter.resize(filterLength, 0.0f);  // Initialize all to zero explicitly
-            
-            // Create triangular filters
-            for (int j = binLeft; j <= binCenter; j++) {
-                if (binCenter > binLeft)  // Avoid division by zero
-                    filter[j] = (j - binLeft) / float(binCenter - binLeft);
-            }
-            for (int j = binCenter; j <= binRight; j++) {
-                if (binRight > binCenter)  // Avoid division by zero
-                    filter[j] = (binRight - j) / float(binRight - binCenter);
-            }
-        }
-    }
-    
-    // Iterative FFT implementation using Cooley-Tukey algorithm
-    std::vector<std::complex<float>> computeFFT(const std::vector<float>& input) {
-        int n = input.size();
-        
-        // Convert input to complex
-        std::vector<std::complex<float>> output(n);
-        for (int i = 0; i < n; i++) {
-            output[i] = std::complex<float>(input[i], 0.0f);
-        }
-        
-        // Bit-reversal permutation
-        int bits = 0;
-        while ((1 << bits) < n) bits++;
-        
-        for (int i = 0; i < n; i++) {
-            int rev = 0;
-            for (int j = 0; j < bits; j++) {
-                rev = (rev << 1) | ((i >> j) & 1);
-            }
-            if (i < rev) {
-                std::swap(output[i], output[rev]);
-            }
-        }
-        
-        // Cooley-Tukey FFT
-        for (int len = 2; len <= n; len <<= 1) {
-            float angle = -2 * M_PI / len;
-            std::complex<float> wlen(std::cos(angle), std::sin(angle));
-            
-            for (int i = 0; i < n; i += len) {
-                std::complex<float> w(1.0f, 0.0f);
-                for (int j = 0; j < len / 2; j++) {
-                    std::complex<float> u = output[i + j];
-                    std::complex<float> v = w * output[i + j + len/2];
-                    
-                    output[i + j] = u + v;
-                    output[i + j + len/2] = u - v;
-                    
-                    w *= wlen;
-                }
-            }
-        }
-        
-        return output;
-    }
-    
-    std::vector<float> getPowerSpectrum(const std::vector<std::complex<float>>& spectrum) {
-        // Only need first half + 1 due to symmetry (real signals)
-        int n = spectrum.size() / 2 + 1;
-        std::vector<float> power(n);
-        
-        for (int i = 0; i < n; i++) {
-            // |X|² = real² + imag²
-            power[i] = std::norm(spectrum[i]);
-        }
-        
-        return power;
-    }
-    
-    std::vector<float> applyMelFilterbank(const std::vector<float>& powerSpectrum) {
-        std::vector<float> melEnergies(melFilterbank.size(), 0.0f);
-        
-        for (size_t i = 0; i < melFilterbank.size(); i++) {
-            const auto& filter = melFilterbank[i];
-            float energy = 0.0f;
-            
-            // Only need to multiply for non-zero filter values
-            for (size_t j = 0; j < std::min(powerSpectrum.size(), filter.size()); j++) {
-                energy += powerSpectrum[j] * filter[j];
-            }
-            
-            melEnergies[i] = energy;
-        }
-        
-        return melEnergies;
-    }
-    
-    std::vector<float> computeDCT(const std::vector<float>& input) {
-        int numCoeffs = 13;  // Typical number of coefficients for MFCC
-        std::vector<float> coeffs(numCoeffs);
-        int N = input.size();
-        
-        // Normalization factor
-        float normFactor0 = 1.0f / std::sqrt(N);
-        float normFactor = std::sqrt(2.0f / N);
-        
-        for (int k = 0; k < numCoeffs; k++) {
-            float sum = 0.0f;
-            for (int n = 0; n < N; n++) {
-                sum += input[n] * std::cos(M_PI * k * (2*n + 1) / (2.0f * N));
-            }
-            
-            // Apply normalization
-            if (k == 0)
-                coeffs[k] = sum * normFactor0;
-            else
-                coeffs[k] = sum * normFactor;
-        }
-        
-        return coeffs;
-    }
-};
+
+#include "signal_processor.h"
+#include "multi_channel_processor.h"
+#include "feature_file.h"
+
+// Thin embind layer over SignalProcessor; all DSP lives in the headers so the
+// same code also builds natively.
+
+namespace {
+
+// Float32Array views over the processor's heap buffers. Views are detached if
+// the heap grows, so callers should re-fetch them if memory growth is enabled.
+emscripten::val heapView(uintptr_t ptr, int length) {
+    return emscripten::val(emscripten::typed_memory_view(length, reinterpret_cast<const float*>(ptr)));
+}
+
+emscripten::val getInputView(SignalProcessor& p) { return heapView(p.getInputPtr(), p.getInputLength()); }
+emscripten::val getOutputView(SignalProcessor& p) { return heapView(p.getOutputPtr(), p.getOutputLength()); }
+emscripten::val getStreamInputView(SignalProcessor& p) { return heapView(p.getStreamInputPtr(), p.getStreamInputLength()); }
+emscripten::val getStreamOutputView(SignalProcessor& p) { return heapView(p.getStreamOutputPtr(), p.getStreamOutputLength()); }
+
+emscripten::val getHistoryView(SignalProcessor& p) { return heapView(p.getHistoryPtr(), p.getHistorySize()); }
+
+// Uint8Array over the quantized history (empty until setHistoryQuantized(true))
+emscripten::val getHistoryBytesView(SignalProcessor& p) {
+    return emscripten::val(emscripten::typed_memory_view(
+        p.getHistoryBytesSize(), reinterpret_cast<const unsigned char*>(p.getHistoryBytesPtr())));
+}
+
+// Float64Array over the PerfStats fields, updated in place as frames are processed
+emscripten::val getPerfStatsView(SignalProcessor& p) {
+    return emscripten::val(emscripten::typed_memory_view(p.getPerfStatsLength(), p.getPerfStats().values));
+}
+
+emscripten::val getMultiStreamInputView(MultiChannelProcessor& p) {
+    return heapView(p.getStreamInputPtr(), p.getStreamInputLength());
+}
+emscripten::val getMultiStreamOutputView(MultiChannelProcessor& p) {
+    return heapView(p.getStreamOutputPtr(), p.getStreamOutputLength());
+}
+
+// Uint8Array over a feature file being written; re-fetch after each write
+// since the buffer grows
+emscripten::val getFeatureFileBytesView(feature_file::HeapWriter& w) {
+    return emscripten::val(emscripten::typed_memory_view(
+        w.getBytesSize(), reinterpret_cast<const unsigned char*>(w.getBytesPtr())));
+}
+
+// Uint8Array over the encoded rows of one block of a parsed feature file
+emscripten::val getFeatureBlockRowsView(feature_file::HeapReader& r, int block) {
+    return emscripten::val(emscripten::typed_memory_view(
+        r.getBlockRowsSize(block), reinterpret_cast<const unsigned char*>(r.getBlockRowsPtr(block))));
+}
+
+}  // namespace
 
 EMSCRIPTEN_BINDINGS(module) {
+    emscripten::enum_<WindowType>("WindowType")
+        .value("Hamming", WindowType::Hamming)
+        .value("Hann", WindowType::Hann)
+        .value("Blackman", WindowType::Blackman)
+        .value("Povey", WindowType::Povey);
+
+    emscripten::enum_<NormalizationMode>("NormalizationMode")
+        .value("FixedRange", NormalizationMode::FixedRange)
+        .value("Cmvn", NormalizationMode::Cmvn)
+        .value("MinMax", NormalizationMode::MinMax);
+
+    emscripten::enum_<SpectrumEngine>("SpectrumEngine")
+        .value("Fft", SpectrumEngine::Fft)
+        .value("SlidingDft", SpectrumEngine::SlidingDft);
+
+    emscripten::value_object<ProcessorConfig>("ProcessorConfig")
+        .field("sampleRate", &ProcessorConfig::sampleRate)
+        .field("frameLength", &ProcessorConfig::frameLength)
+        .field("fftSize", &ProcessorConfig::fftSize)
+        .field("hopLength", &ProcessorConfig::hopLength)
+        .field("numBands", &ProcessorConfig::numBands)
+        .field("numCoeffs", &ProcessorConfig::numCoeffs)
+        .field("fMin", &ProcessorConfig::fMin)
+        .field("fMax", &ProcessorConfig::fMax)
+        .field("windowType", &ProcessorConfig::windowType)
+        .field("deltaOrder", &ProcessorConfig::deltaOrder)
+        .field("deltaWindow", &ProcessorConfig::deltaWindow)
+        .field("spectrumEngine", &ProcessorConfig::spectrumEngine)
+        .field("slidingDftResync", &ProcessorConfig::slidingDftResync);
+
+    // Defaults to spread and override from JS, e.g. { ...getDefaultConfig(), sampleRate }
+    emscripten::function("getDefaultConfig", +[]() { return ProcessorConfig(); });
+
     emscripten::class_<SignalProcessor>("SignalProcessor")
         .constructor<>()
-        .function("processSamples", &SignalProcessor::processSamples);
+        .constructor<const ProcessorConfig&>()
+        .function("getConfig", &SignalProcessor::getConfig)
+        .function("getOutputWidth", &SignalProcessor::getOutputWidth)
+        .function("getDeltaDelay", &SignalProcessor::getDeltaDelay)
+        .function("processSamples", &SignalProcessor::processSamples)
+        .function("processInPlace", &SignalProcessor::processInPlace)
+        .function("setUseRealFft", &SignalProcessor::setUseRealFft)
+        .function("getUseRealFft", &SignalProcessor::getUseRealFft)
+        .function("setUseSpecialized", &SignalProcessor::setUseSpecialized)
+        .function("getUseSpecialized", &SignalProcessor::getUseSpecialized)
+        .function("getInputPtr", &SignalProcessor::getInputPtr)
+        .function("getInputLength", &SignalProcessor::getInputLength)
+        .function("getOutputPtr", &SignalProcessor::getOutputPtr)
+        .function("getOutputLength", &SignalProcessor::getOutputLength)
+        .function("getInputView", &getInputView)
+        .function("getOutputView", &getOutputView)
+        .class_function("getAllocationCount", &SignalProcessor::getAllocationCount)
+        .class_function("isAllocationCountingEnabled", &SignalProcessor::isAllocationCountingEnabled)
+        .function("processBatch", &SignalProcessor::processBatchFromHeap)
+        .function("setNumThreads", &SignalProcessor::setNumThreads)
+        .function("getNumThreads", &SignalProcessor::getNumThreads)
+        .function("pushSamples", &SignalProcessor::pushSamplesFromHeap)
+        .function("resetStream", &SignalProcessor::resetStream)
+        .function("getMaxFramesPerPush", &SignalProcessor::getMaxFramesPerPush)
+        .function("getDroppedFrames", &SignalProcessor::getDroppedFrames)
+        .function("getStreamInputPtr", &SignalProcessor::getStreamInputPtr)
+        .function("getStreamOutputPtr", &SignalProcessor::getStreamOutputPtr)
+        .function("getStreamInputView", &getStreamInputView)
+        .function("getStreamOutputView", &getStreamOutputView)
+        .function("setInstrumentationEnabled", &SignalProcessor::setInstrumentationEnabled)
+        .function("isInstrumentationEnabled", &SignalProcessor::isInstrumentationEnabled)
+        .function("resetPerfStats", &SignalProcessor::resetPerfStats)
+        .function("getPerfStatsPtr", &SignalProcessor::getPerfStatsPtr)
+        .function("getPerfStatsView", &getPerfStatsView)
+        .function("setHistoryLength", &SignalProcessor::setHistoryLength)
+        .function("getHistoryLength", &SignalProcessor::getHistoryLength)
+        .function("setHistoryMapping", &SignalProcessor::setHistoryMapping)
+        .function("setHistoryRange", &SignalProcessor::setHistoryRange)
+        .function("clearHistory", &SignalProcessor::clearHistory)
+        .function("adoptHistory", &SignalProcessor::adoptHistory)
+        .function("getHistoryWriteRow", &SignalProcessor::getHistoryWriteRow)
+        .function("getHistoryFramesWritten", &SignalProcessor::getHistoryFramesWritten)
+        .function("getHistoryPtr", &SignalProcessor::getHistoryPtr)
+        .function("getHistoryView", &getHistoryView)
+        .function("setNormalizationMode", &SignalProcessor::setNormalizationMode)
+        .function("getNormalizationMode", &SignalProcessor::getNormalizationMode)
+        .function("setNormalizationDecay", &SignalProcessor::setNormalizationDecay)
+        .function("setNormalizationZRange", &SignalProcessor::setNormalizationZRange)
+        .function("setHistoryQuantized", &SignalProcessor::setHistoryQuantized)
+        .function("isHistoryQuantized", &SignalProcessor::isHistoryQuantized)
+        .function("getHistoryBytesPtr", &SignalProcessor::getHistoryBytesPtr)
+        .function("getHistoryBytesView", &getHistoryBytesView);
+    
+    emscripten::class_<MultiChannelProcessor>("MultiChannelProcessor")
+        .constructor<const ProcessorConfig&, int>()
+        .function("getConfig", &MultiChannelProcessor::getConfig)
+        .function("getNumChannels", &MultiChannelProcessor::getNumChannels)
+        .function("getOutputWidth", &MultiChannelProcessor::getOutputWidth)
+        .function("getFrameStride", &MultiChannelProcessor::getFrameStride)
+        .function("pushInterleavedFromHeap", &MultiChannelProcessor::pushInterleavedFromHeap)
+        .function("pushPlanarFromHeap", &MultiChannelProcessor::pushPlanarFromHeap)
+        .function("processBatchInterleavedFromHeap", &MultiChannelProcessor::processBatchInterleavedFromHeap)
+        .function("processBatchPlanarFromHeap", &MultiChannelProcessor::processBatchPlanarFromHeap)
+        .function("resetStream", &MultiChannelProcessor::resetStream)
+        .function("getDeltaDelay", &MultiChannelProcessor::getDeltaDelay)
+        .function("getMaxFramesPerPush", &MultiChannelProcessor::getMaxFramesPerPush)
+        .function("getDroppedFrames", &MultiChannelProcessor::getDroppedFrames)
+        .function("getStreamInputPtr", &MultiChannelProcessor::getStreamInputPtr)
+        .function("getStreamInputView", &getMultiStreamInputView)
+        .function("getStreamOutputPtr", &MultiChannelProcessor::getStreamOutputPtr)
+        .function("getStreamOutputView", &getMultiStreamOutputView);
+
+    emscripten::enum_<feature_file::Encoding>("FeatureEncoding")
+        .value("Float32", feature_file::Encoding::Float32)
+        .value("Float16", feature_file::Encoding::Float16)
+        .value("Uint8", feature_file::Encoding::Uint8);
+
+    emscripten::class_<feature_file::HeapWriter>("FeatureFileWriter")
+        .constructor<const ProcessorConfig&, feature_file::Encoding, int>()
+        .function("writeFromHeap", &feature_file::HeapWriter::writeFromHeap)
+        .function("finish", &feature_file::HeapWriter::finish)
+        .function("getNumFrames", &feature_file::HeapWriter::getNumFrames)
+        .function("getBytesPtr", &feature_file::HeapWriter::getBytesPtr)
+        .function("getBytesSize", &feature_file::HeapWriter::getBytesSize)
+        .function("getBytesView", &getFeatureFileBytesView);
+
+    emscripten::class_<feature_file::HeapReader>("FeatureFileReader")
+        .constructor<>()
+        .function("allocate", &feature_file::HeapReader::allocate)
+        .function("parse", &feature_file::HeapReader::parse)
+        .function("getNumFrames", &feature_file::HeapReader::getNumFrames)
+        .function("getWidth", &feature_file::HeapReader::getWidth)
+        .function("getNumCoeffs", &feature_file::HeapReader::getNumCoeffs)
+        .function("getDeltaOrder", &feature_file::HeapReader::getDeltaOrder)
+        .function("getSampleRate", &feature_file::HeapReader::getSampleRate)
+        .function("getHopLength", &feature_file::HeapReader::getHopLength)
+        .function("getVersion", &feature_file::HeapReader::getVersion)
+        .function("getEncoding", &feature_file::HeapReader::getEncoding)
+        .function("getNumBlocks", &feature_file::HeapReader::getNumBlocks)
+        .function("getBlockFrames", &feature_file::HeapReader::getBlockFrames)
+        .function("getBlockRowsPtr", &feature_file::HeapReader::getBlockRowsPtr)
+        .function("getBlockRowsView", &getFeatureBlockRowsView)
+        .function("readFramesToHeap", &feature_file::HeapReader::readFramesToHeap);
+
+    // True when this module was built with the WASM SIMD128 kernels
+    emscripten::function("isSimdBuild", +[]() { return kernels::kSimdEnabled; });
     
     // Register vector types
     emscripten::register_vector<float>("FloatVector");
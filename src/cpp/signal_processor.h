@@ -0,0 +1,497 @@
+#pragma once
+
+#include <vector>
+#include <complex>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <memory>
+
+#include "processor_config.h"
+#include "fft_plan.h"
+#include "mel_filterbank.h"
+#include "dct.h"
+#include "window.h"
+#include "ring_buffer.h"
+#include "scratch_arena.h"
+#include "alloc_counter.h"
+#include "perf_stats.h"
+#include "feature_history.h"
+#include "delta_stage.h"
+#include "sliding_dft.h"
+#include "mfcc_pipeline.h"
+#include "simd_kernels.h"
+
+#ifdef SIGNAL_PROCESSOR_THREADS
+#include "worker_pool.h"
+#endif
+
+// MFCC pipeline without any binding code, shared by the embind module
+// (signal_processor.cpp) and the native targets.
+class SignalProcessor {
+public:
+    // Largest push that can never overrun the stream output buffer
+    static constexpr int kMaxPushSamples = 8192;
+
+    // Defaults match the AnalyserNode in App.jsx (fftSize 2048 -> frequencyBinCount 1024)
+    SignalProcessor() : SignalProcessor(ProcessorConfig()) {}
+
+    explicit SignalProcessor(const ProcessorConfig& requested)
+        : config(sanitizeConfig(requested)),
+          fftPlan(config.fftSize),
+          realFftPlan(config.fftSize),
+          melFilterbank(config.fftSize, config.sampleRate, config.numBands, config.fMin, config.fMax),
+          dctPlan(config.numBands, config.numCoeffs),
+          window(buildWindow(config.windowType, config.frameLength)),
+          inputBuffer(config.frameLength, 0.0f),
+          outputBuffer(outputWidth(config), 0.0f),
+          streamRing(config.frameLength),
+          streamFrame(config.frameLength, 0.0f),
+          streamInput(kMaxPushSamples, 0.0f),
+          streamOutput(static_cast<size_t>(getMaxFramesPerPush()) * outputWidth(config), 0.0f),
+          samplesUntilFrame(config.frameLength),
+          scratch(config, dctPlan.getScratchSize()),
+          deltaStage(config),
+          specialized(makeSpecializedPipeline(config)) {
+        if (config.spectrumEngine == SpectrumEngine::SlidingDft) {
+            slidingDft.reset(new SlidingDft(config));
+        }
+    }
+
+    const ProcessorConfig& getConfig() const { return config; }
+    
+    // Floats per output frame: numCoeffs, or 2x/3x that with deltaOrder 1/2
+    int getOutputWidth() const { return outputWidth(config); }
+
+    // Processes one frame. Only the first frameLength samples are used, shorter
+    // input is zero-padded.
+    // With deltaOrder > 0 the frame-by-frame calls (processSamples,
+    // processInPlace, pushSamples) form one stream: each returns
+    // getOutputWidth() values for the frame getDeltaDelay() calls back, the
+    // statics followed by its deltas (see DeltaStage).
+    std::vector<float> processSamples(const std::vector<float>& samples) {
+        std::vector<float> coeffs(getOutputWidth());
+        computeCoefficients(samples.data(), samples.size(), coeffs.data());
+        deltaStage.push(coeffs.data(), coeffs.data());
+        return coeffs;
+    }
+
+    // Zero-copy frame API: JS writes samples straight into inputBuffer (via the
+    // view or HEAPF32 at getInputPtr()), calls processInPlace() and reads the
+    // coefficients back through the output view. Both buffers live for as long
+    // as the processor, so nothing is allocated on the JS side per frame.
+    void processInPlace() {
+        computeCoefficients(inputBuffer.data(), inputBuffer.size(), outputBuffer.data());
+        recordHistory(outputBuffer.data());
+        deltaStage.push(outputBuffer.data(), outputBuffer.data());
+    }
+
+    // Batch API: frame f starts at input + f * hop and is frameLength samples
+    // long; its coefficients land at output + f * getOutputWidth(), giving one
+    // contiguous numFrames x width matrix per call.
+    // In the threaded build the frames are split across the worker pool.
+    // Deltas are computed per batch, aligned with their frame and with the
+    // first/last frame replicated at the edges; the batch does not touch the
+    // streaming delta state.
+    void processBatch(const float* input, int numFrames, int hop, float* output) {
+        processBatchStatics(input, numFrames, hop, output);
+        if (config.deltaOrder > 0) {
+            DeltaStage::applyAligned(config, output, numFrames);
+        }
+    }
+
+    // Pointer-as-integer entry point for bindings: both pointers are byte offsets into the module heap
+    // (e.g. from Module._malloc), input must hold (numFrames-1)*hop + frameLength samples
+    void processBatchFromHeap(uintptr_t inputPtr, int numFrames, int hop, uintptr_t outputPtr) {
+        processBatch(reinterpret_cast<const float*>(inputPtr), numFrames, hop,
+                     reinterpret_cast<float*>(outputPtr));
+    }
+
+    // Number of threads processBatch may use (the caller included). Each extra
+    // thread gets its own scratch arena; plans, window, filterbank and DCT
+    // basis are read-only and shared. Always 1 in builds without
+    // SIGNAL_PROCESSOR_THREADS.
+    void setNumThreads(int numThreads) {
+#ifdef SIGNAL_PROCESSOR_THREADS
+        numThreads = std::max(1, numThreads);
+        if (numThreads == getNumThreads()) return;
+        workerPool.reset();
+        workerScratch.clear();
+        workerStats.clear();
+        if (numThreads > 1) {
+            workerStats.resize(numThreads);
+            for (int w = 1; w < numThreads; w++) {
+                workerScratch.emplace_back(new FrameScratch(config, dctPlan.getScratchSize()));
+            }
+            workerPool.reset(new WorkerPool(numThreads));
+        }
+#else
+        (void)numThreads;
+#endif
+    }
+
+    int getNumThreads() const {
+#ifdef SIGNAL_PROCESSOR_THREADS
+        return workerPool ? workerPool->size() : 1;
+#else
+        return 1;
+#endif
+    }
+
+    // Streaming API: samples are appended to a ring buffer and a frame is
+    // produced once frameLength samples are available and then every hopLength
+    // samples, so the frame rate follows the audio clock rather than the caller.
+    // Returns the number of frames written to the stream output buffer
+    // (getOutputWidth() floats each, oldest first); the buffer is overwritten by the
+    // next push. Frames beyond getMaxFramesPerPush() are dropped and counted.
+    // With SpectrumEngine::SlidingDft every sample also advances the sliding
+    // DFT, and frames take their spectrum from it instead of an FFT.
+    int pushSamples(const float* samples, int n) {
+        int frames = 0;
+        while (n > 0) {
+            int chunk = std::min(n, samplesUntilFrame);
+            streamRing.write(samples, chunk);
+            if (slidingDft) slidingDft->push(samples, chunk);
+            samples += chunk;
+            n -= chunk;
+            samplesUntilFrame -= chunk;
+
+            if (samplesUntilFrame == 0) {
+                samplesUntilFrame = config.hopLength;
+                if (frames < getMaxFramesPerPush()) {
+                    float* frameOut = streamOutput.data() + frames * outputWidth(config);
+                    if (slidingDft) {
+                        computeSlidingCoefficients(frameOut, scratch, activeStats());
+                    } else {
+                        streamRing.copyLatest(streamFrame.data(), config.frameLength);
+                        computeCoefficients(streamFrame.data(), streamFrame.size(), frameOut);
+                    }
+                    recordHistory(frameOut);
+                    deltaStage.push(frameOut, frameOut);
+                    frames++;
+                } else {
+                    droppedFrames++;
+                    perfStats.values[PerfStats::DroppedFrames] += 1.0;
+                }
+            }
+        }
+        return frames;
+    }
+
+    // Pointer-as-integer entry point for bindings: ptr is a byte offset into the
+    // module heap, usually getStreamInputPtr() after filling the stream input view
+    int pushSamplesFromHeap(uintptr_t ptr, int n) {
+        return pushSamples(reinterpret_cast<const float*>(ptr), n);
+    }
+
+    // Forgets all buffered samples, the next frame needs a full frameLength
+    // again and the delta history starts over
+    void resetStream() {
+        streamRing.clear();
+        samplesUntilFrame = config.frameLength;
+        deltaStage.reset();
+        if (slidingDft) slidingDft->clear();
+    }
+
+    // Frames between a streamed input frame and its output row (deltaOrder * deltaWindow)
+    int getDeltaDelay() const { return deltaStage.getDelay(); }
+
+    int getMaxFramesPerPush() const { return kMaxPushSamples / config.hopLength + 1; }
+    int getDroppedFrames() const { return droppedFrames; }
+
+    uintptr_t getStreamInputPtr() const { return reinterpret_cast<uintptr_t>(streamInput.data()); }
+    int getStreamInputLength() const { return static_cast<int>(streamInput.size()); }
+    uintptr_t getStreamOutputPtr() const { return reinterpret_cast<uintptr_t>(streamOutput.data()); }
+    int getStreamOutputLength() const { return static_cast<int>(streamOutput.size()); }
+
+    // Debug counter of heap allocations made through operator new. Stays at 0
+    // unless built with SIGNAL_PROCESSOR_COUNT_ALLOCATIONS; compare it before
+    // and after a frame to check the hot path does not allocate.
+    static double getAllocationCount() { return static_cast<double>(alloc_counter::count()); }
+    static bool isAllocationCountingEnabled() { return alloc_counter::enabled(); }
+
+    // Optional per-stage timers and frame counters (off by default). While
+    // enabled every frame reads the clock once per stage; dropped stream frames
+    // are counted either way. JS reads the fields through getPerfStatsView().
+    void setInstrumentationEnabled(bool enabled) { instrumented = enabled; }
+    bool isInstrumentationEnabled() const { return instrumented; }
+    void resetPerfStats() { perfStats.reset(); }
+    const PerfStats& getPerfStats() const { return perfStats; }
+    uintptr_t getPerfStatsPtr() const { return reinterpret_cast<uintptr_t>(perfStats.values); }
+    int getPerfStatsLength() const { return PerfStats::kNumFields; }
+
+    // Display history for the renderer: with numRows > 0, every frame from
+    // processInPlace() and pushSamples() is also normalized to display units
+    // (see Normalizer) and written as one row of a numRows x numCoeffs heap buffer in the history
+    // texture layout (see FeatureHistory), so WebGL can upload it from a heap
+    // view without JS copies. 0 disables it. Allocates only here.
+    void setHistoryLength(int numRows) {
+        if (numRows <= 0) {
+            history.reset();
+        } else if (!history || history->getNumRows() != numRows) {
+            history.reset(new FeatureHistory(config.numCoeffs, numRows));
+        }
+    }
+    int getHistoryLength() const { return history ? history->getNumRows() : 0; }
+    // FixedRange mapping: display = coefficient * scale + offset
+    void setHistoryMapping(int coeff, float scale, float offset) {
+        if (history) history->getNormalizer().setFixedMapping(coeff, scale, offset);
+    }
+    // Display range every normalization mode clamps to (default 0-100)
+    void setHistoryRange(float minValue, float maxValue) {
+        if (history) history->getNormalizer().setRange(minValue, maxValue);
+    }
+    void setNormalizationMode(NormalizationMode mode) {
+        if (history) history->getNormalizer().setMode(mode);
+    }
+    NormalizationMode getNormalizationMode() const {
+        return history ? history->getNormalizer().getMode() : NormalizationMode::FixedRange;
+    }
+    // Weight of the newest frame in the Cmvn/MinMax running statistics
+    void setNormalizationDecay(float decay) {
+        if (history) history->getNormalizer().setDecay(decay);
+    }
+    // Standard deviations either side of the mean shown by Cmvn
+    void setNormalizationZRange(float zRange) {
+        if (history) history->getNormalizer().setZRange(zRange);
+    }
+    // Also keep the history as uint8 (range -> 0..255) for LUMINANCE/UNSIGNED_BYTE textures
+    void setHistoryQuantized(bool enabled) {
+        if (history) history->setQuantized(enabled);
+    }
+    bool isHistoryQuantized() const { return history && history->isQuantized(); }
+    uintptr_t getHistoryBytesPtr() const { return history ? reinterpret_cast<uintptr_t>(history->byteData()) : 0; }
+    int getHistoryBytesSize() const { return history ? history->byteSize() : 0; }
+    void clearHistory() {
+        if (history) history->clear();
+    }
+    // Takes over other's display history (rows, write position, mapping and
+    // normalizer state) when both produce the same number of coefficients.
+    // The heap buffer moves with it, so existing views stay valid; used when a
+    // processor is replaced by one of a different shape.
+    void adoptHistory(SignalProcessor& other) {
+        if (other.history && other.config.numCoeffs == config.numCoeffs) {
+            history = std::move(other.history);
+        }
+    }
+    int getHistoryWriteRow() const { return history ? history->getWriteRow() : 0; }
+    int getHistoryFramesWritten() const { return history ? history->getFramesWritten() : 0; }
+    uintptr_t getHistoryPtr() const { return history ? reinterpret_cast<uintptr_t>(history->data()) : 0; }
+    int getHistorySize() const { return history ? history->size() : 0; }
+
+    // Selects the packed real-input FFT (default) or the full complex FFT
+    void setUseRealFft(bool enabled) { useRealFft = enabled; }
+    bool getUseRealFft() const { return useRealFft; }
+
+    // The baked default shape runs its frames through a compile-time
+    // MfccPipeline (with the real FFT); results are identical to the runtime
+    // path, which can be forced for comparison by disabling it
+    void setUseSpecialized(bool enabled) { useSpecialized = enabled; }
+    bool getUseSpecialized() const { return useSpecialized && specialized && useRealFft; }
+
+    uintptr_t getInputPtr() const { return reinterpret_cast<uintptr_t>(inputBuffer.data()); }
+    int getInputLength() const { return static_cast<int>(inputBuffer.size()); }
+    uintptr_t getOutputPtr() const { return reinterpret_cast<uintptr_t>(outputBuffer.data()); }
+    int getOutputLength() const { return static_cast<int>(outputBuffer.size()); }
+
+private:
+    ProcessorConfig config;
+    FftPlan fftPlan;
+    RealFftPlan realFftPlan;
+    MelFilterbank melFilterbank;
+    DctPlan dctPlan;
+    std::vector<float> window;  // analysis window for config.windowType
+    std::vector<float> inputBuffer;
+    std::vector<float> outputBuffer;
+    bool useRealFft = true;
+    bool useSpecialized = true;
+
+    // Streaming engine state
+    SampleRingBuffer streamRing;
+    std::vector<float> streamFrame;
+    std::vector<float> streamInput;
+    std::vector<float> streamOutput;
+    int samplesUntilFrame;
+    int droppedFrames = 0;
+
+    bool instrumented = false;
+    PerfStats perfStats;
+
+    std::unique_ptr<FeatureHistory> history;  // null unless setHistoryLength() > 0
+
+    // Per-instance working buffers, one arena sized from the config
+    FrameScratch scratch;
+
+    // Streaming delta/delta-delta history (pass-through when deltaOrder is 0)
+    DeltaStage deltaStage;
+
+    // Spectrum engine for pushSamples(), null unless SpectrumEngine::SlidingDft
+    std::unique_ptr<SlidingDft> slidingDft;
+
+    // Compile-time specialized frame path, null unless the shape has one
+    std::unique_ptr<FramePipeline> specialized;
+
+    PerfStats* activeStats() { return instrumented ? &perfStats : nullptr; }
+
+    void recordHistory(const float* coeffs) {
+        if (history) history->push(coeffs);
+    }
+
+    // Runs the full pipeline on one frame and writes numCoeffs values to coeffs.
+    // Works entirely in `work`, so nothing is allocated per frame. Stage times
+    // are added to stats when it is non-null.
+    void computeCoefficients(const float* samples, size_t count, float* coeffs,
+                             FrameScratch& work, PerfStats* stats) const {
+        if (getUseSpecialized()) {
+            specialized->compute(samples, static_cast<int>(std::min(count, static_cast<size_t>(config.frameLength))),
+                                 coeffs, work, stats);
+            return;
+        }
+
+        StageClock clock(stats != nullptr);
+        int used = static_cast<int>(std::min(count, static_cast<size_t>(config.frameLength)));
+        
+        // Steps 1+2: window (cached table, fused into the FFT input load),
+        // zero-pad up to the FFT size and transform. The real-input transform
+        // is the default and only produces the fftSize/2+1 non-redundant bins.
+        if (useRealFft) {
+            computeRealFFT(samples, used, work.spectrum);
+        } else {
+            computeFFT(samples, used, work.spectrum);
+        }
+        if (stats) stats->values[PerfStats::FftMs] += clock.lap();
+
+        spectrumToCoefficients(coeffs, work, stats, clock);
+    }
+
+    // Streamed frame from the sliding DFT: resync from an exact FFT of the
+    // frame when due, then steps 3-6 as usual
+    void computeSlidingCoefficients(float* coeffs, FrameScratch& work, PerfStats* stats) {
+        StageClock clock(stats != nullptr);
+        if (slidingDft->getFramesSinceResync() >= config.slidingDftResync) {
+            streamRing.copyLatest(streamFrame.data(), config.frameLength);
+            slidingDft->resync(streamFrame.data(), fftPlan, work.spectrum);
+        }
+        slidingDft->windowedSpectrum(work.spectrum);
+        if (stats) stats->values[PerfStats::FftMs] += clock.lap();
+
+        spectrumToCoefficients(coeffs, work, stats, clock);
+    }
+
+    // Steps 3-6 on the fftSize/2+1 bins in work.spectrum
+    void spectrumToCoefficients(float* coeffs, FrameScratch& work, PerfStats* stats, StageClock& clock) const {
+        int numBins = config.fftSize / 2 + 1;
+
+        // Step 3: Get power spectrum (only need first half due to symmetry)
+        getPowerSpectrum(work.spectrum, work.power, numBins);
+        if (stats) stats->values[PerfStats::PowerMs] += clock.lap();
+        
+        // Step 4: Apply mel filterbank
+        applyMelFilterbank(work.power, numBins, work.mel);
+        if (stats) stats->values[PerfStats::MelMs] += clock.lap();
+        
+        // Step 5: Take log (with proper floor value to avoid numerical issues),
+        // libm or polynomial depending on kPrecision (see fast_math.h)
+        kernels::logFloor<kPrecision>(work.mel, 1e-10f, config.numBands);
+        if (stats) stats->values[PerfStats::LogMs] += clock.lap();
+        
+        // Step 6: Apply DCT to get cepstral coefficients (with proper normalization)
+        computeDCT(work.mel, coeffs, work.dct);
+        if (stats) {
+            stats->values[PerfStats::DctMs] += clock.lap();
+            stats->addFrame(clock.total());
+        }
+    }
+
+    void computeCoefficients(const float* samples, size_t count, float* coeffs) {
+        computeCoefficients(samples, count, coeffs, scratch, activeStats());
+    }
+
+    // Static coefficients of a batch at getOutputWidth() stride
+    void processBatchStatics(const float* input, int numFrames, int hop, float* output) {
+#ifdef SIGNAL_PROCESSOR_THREADS
+        if (workerPool && numFrames >= 2 * workerPool->size()) {
+            // Each worker times its frames into its own PerfStats, merged in
+            // worker order once the batch is done, so stage and total times
+            // are per-frame compute time summed over workers as on one thread
+            if (instrumented) {
+                for (PerfStats& stats : workerStats) stats.reset();
+            }
+            BatchJob job{this, input, hop, output, instrumented};
+            workerPool->run(numFrames, &SignalProcessor::runBatchRange, &job);
+            if (instrumented) {
+                for (const PerfStats& stats : workerStats) perfStats.merge(stats);
+            }
+            return;
+        }
+#endif
+        processBatchRange(input, 0, numFrames, hop, output, scratch, activeStats());
+    }
+
+    void processBatchRange(const float* input, int begin, int end, int hop, float* output,
+                           FrameScratch& work, PerfStats* stats) const {
+        for (int f = begin; f < end; f++) {
+            computeCoefficients(input + static_cast<size_t>(f) * hop, config.frameLength,
+                                output + static_cast<size_t>(f) * outputWidth(config), work, stats);
+        }
+    }
+
+#ifdef SIGNAL_PROCESSOR_THREADS
+    std::unique_ptr<WorkerPool> workerPool;
+    std::vector<std::unique_ptr<FrameScratch>> workerScratch;  // one per extra worker
+    std::vector<PerfStats> workerStats;                        // one per worker, caller included
+
+    struct BatchJob {
+        const SignalProcessor* processor;
+        const float* input;
+        int hop;
+        float* output;
+        bool instrumented;
+    };
+
+    static void runBatchRange(void* ctx, int begin, int end, int worker) {
+        BatchJob* job = static_cast<BatchJob*>(ctx);
+        SignalProcessor* self = const_cast<SignalProcessor*>(job->processor);
+        FrameScratch& work = worker == 0 ? self->scratch : *self->workerScratch[worker - 1];
+        PerfStats* stats = job->instrumented ? &self->workerStats[worker] : nullptr;
+        job->processor->processBatchRange(job->input, begin, end, job->hop, job->output, work, stats);
+    }
+#endif
+    
+    // Real-to-complex FFT through a packed n/2-point complex transform,
+    // writes the n/2+1 bins getPowerSpectrum needs
+    void computeRealFFT(const float* input, int count, std::complex<float>* output) const {
+        realFftPlan.executeWindowed(input, window.data(), count, output);
+    }
+
+    // Iterative FFT implementation using Cooley-Tukey algorithm
+    void computeFFT(const float* input, int count, std::complex<float>* output) const {
+        int n = config.fftSize;
+        
+        // Convert windowed input to complex, zero-padded to the FFT size
+        for (int i = 0; i < count; i++) {
+            output[i] = std::complex<float>(input[i] * window[i], 0.0f);
+        }
+        for (int i = count; i < n; i++) {
+            output[i] = std::complex<float>(0.0f, 0.0f);
+        }
+        
+        fftPlan.execute(output);
+    }
+    
+    void getPowerSpectrum(const std::complex<float>* spectrum, float* power, int numBins) const {
+        // Only need first half + 1 due to symmetry (real signals)
+        // |X|² = real² + imag²
+        kernels::complexNorm(spectrum, power, numBins);
+    }
+    
+    void applyMelFilterbank(const float* powerSpectrum, int numBins, float* melEnergies) const {
+        // Only the nonzero span of each triangle is multiplied
+        melFilterbank.apply(powerSpectrum, numBins, melEnergies);
+    }
+    
+    void computeDCT(const float* input, float* coeffs, std::complex<float>* dctScratch) const {
+        // Precomputed orthonormal DCT-II basis, one small mat-vec per frame
+        dctPlan.apply(input, coeffs, dctScratch);
+    }
+};
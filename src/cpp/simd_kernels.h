@@ -0,0 +1,247 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+
+#include "fast_math.h"
+
+#ifdef __wasm_simd128__
+#include <wasm_simd128.h>
+#endif
+
+// Per-frame inner loops of the MFCC pipeline.
+// Built with -msimd128 the WASM SIMD128 versions are used, otherwise the scalar
+// loops. The two variants are compiled into separate modules and the JS loader
+// picks one at module-load time (see loadWasm in App.jsx).
+namespace kernels {
+
+#ifdef __wasm_simd128__
+constexpr bool kSimdEnabled = true;
+#else
+constexpr bool kSimdEnabled = false;
+#endif
+
+// data[i] *= weights[i]
+inline void multiply(float* data, const float* weights, int n) {
+    int i = 0;
+#ifdef __wasm_simd128__
+    for (; i + 4 <= n; i += 4) {
+        v128_t d = wasm_v128_load(data + i);
+        v128_t w = wasm_v128_load(weights + i);
+        wasm_v128_store(data + i, wasm_f32x4_mul(d, w));
+    }
+#endif
+    for (; i < n; i++) {
+        data[i] *= weights[i];
+    }
+}
+
+// Sum of a[i] * b[i]
+inline float dot(const float* a, const float* b, int n) {
+    float sum = 0.0f;
+    int i = 0;
+#ifdef __wasm_simd128__
+    v128_t acc = wasm_f32x4_splat(0.0f);
+    for (; i + 4 <= n; i += 4) {
+        acc = wasm_f32x4_add(acc, wasm_f32x4_mul(wasm_v128_load(a + i), wasm_v128_load(b + i)));
+    }
+    sum = wasm_f32x4_extract_lane(acc, 0) + wasm_f32x4_extract_lane(acc, 1) +
+          wasm_f32x4_extract_lane(acc, 2) + wasm_f32x4_extract_lane(acc, 3);
+#endif
+    for (; i < n; i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+// out[i] = sum over r of weights[r] * rows[r * stride + i], for i < n.
+// Columns are summed in groups kept in registers; each one is accumulated in
+// the order of the scalar dot() loop, so in the scalar build a column matches
+// dot() of its gathered values exactly. A single contiguous column (one
+// channel) is dot() itself, vectorized over the rows.
+inline void weightedColumnSum(const float* rows, int stride, const float* weights, int numRows,
+                              float* out, int n) {
+    if (n == 1 && stride == 1) {
+        out[0] = dot(rows, weights, numRows);
+        return;
+    }
+    int i = 0;
+#ifdef __wasm_simd128__
+    for (; i + 4 <= n; i += 4) {
+        v128_t acc = wasm_f32x4_splat(0.0f);
+        for (int r = 0; r < numRows; r++) {
+            acc = wasm_f32x4_add(acc, wasm_f32x4_mul(wasm_f32x4_splat(weights[r]),
+                                                     wasm_v128_load(rows + static_cast<size_t>(r) * stride + i)));
+        }
+        wasm_v128_store(out + i, acc);
+    }
+#else
+    for (; i + 4 <= n; i += 4) {
+        float a0 = 0.0f, a1 = 0.0f, a2 = 0.0f, a3 = 0.0f;
+        for (int r = 0; r < numRows; r++) {
+            const float* x = rows + static_cast<size_t>(r) * stride + i;
+            a0 += weights[r] * x[0];
+            a1 += weights[r] * x[1];
+            a2 += weights[r] * x[2];
+            a3 += weights[r] * x[3];
+        }
+        out[i] = a0;
+        out[i + 1] = a1;
+        out[i + 2] = a2;
+        out[i + 3] = a3;
+    }
+#endif
+    for (; i < n; i++) {
+        float sum = 0.0f;
+        for (int r = 0; r < numRows; r++) {
+            sum += weights[r] * rows[static_cast<size_t>(r) * stride + i];
+        }
+        out[i] = sum;
+    }
+}
+
+// out[i] = clamp(in[i] * scale[i] + offset[i], lo, hi), std::min/std::max semantics
+inline void affineClamp(const float* in, const float* scale, const float* offset,
+                        float lo, float hi, float* out, int n) {
+    int i = 0;
+#ifdef __wasm_simd128__
+    const v128_t vLo = wasm_f32x4_splat(lo);
+    const v128_t vHi = wasm_f32x4_splat(hi);
+    for (; i + 4 <= n; i += 4) {
+        v128_t v = wasm_f32x4_add(wasm_f32x4_mul(wasm_v128_load(in + i), wasm_v128_load(scale + i)),
+                                  wasm_v128_load(offset + i));
+        // pmax/pmin pick the same operand as std::max/std::min
+        v = wasm_f32x4_pmin(wasm_f32x4_pmax(v, vLo), vHi);
+        wasm_v128_store(out + i, v);
+    }
+#endif
+    for (; i < n; i++) {
+        out[i] = std::min(std::max(in[i] * scale[i] + offset[i], lo), hi);
+    }
+}
+
+// out[i] = |in[i]|² = real² + imag²
+inline void complexNorm(const std::complex<float>* in, float* out, int n) {
+    int i = 0;
+#ifdef __wasm_simd128__
+    const float* src = reinterpret_cast<const float*>(in);
+    for (; i + 4 <= n; i += 4) {
+        v128_t a = wasm_v128_load(src + 2 * i);      // re0 im0 re1 im1
+        v128_t b = wasm_v128_load(src + 2 * i + 4);  // re2 im2 re3 im3
+        v128_t re = wasm_i32x4_shuffle(a, b, 0, 2, 4, 6);
+        v128_t im = wasm_i32x4_shuffle(a, b, 1, 3, 5, 7);
+        wasm_v128_store(out + i, wasm_f32x4_add(wasm_f32x4_mul(re, re), wasm_f32x4_mul(im, im)));
+    }
+#endif
+    for (; i < n; i++) {
+        out[i] = in[i].real() * in[i].real() + in[i].imag() * in[i].imag();
+    }
+}
+
+// One group of radix-2 butterflies: lo[j], hi[j] <- lo[j] ± tw[j] * hi[j]
+inline void butterflies(std::complex<float>* lo, std::complex<float>* hi,
+                        const std::complex<float>* tw, int half) {
+    int j = 0;
+#ifdef __wasm_simd128__
+    float* loF = reinterpret_cast<float*>(lo);
+    float* hiF = reinterpret_cast<float*>(hi);
+    const float* twF = reinterpret_cast<const float*>(tw);
+    const v128_t signs = wasm_f32x4_make(-1.0f, 1.0f, -1.0f, 1.0f);
+    for (; j + 2 <= half; j += 2) {
+        v128_t w = wasm_v128_load(twF + 2 * j);
+        v128_t x = wasm_v128_load(hiF + 2 * j);
+        v128_t u = wasm_v128_load(loF + 2 * j);
+
+        // (wr + i wi)(xr + i xi) = (wr xr - wi xi) + i (wr xi + wi xr)
+        v128_t wRe = wasm_i32x4_shuffle(w, w, 0, 0, 2, 2);
+        v128_t wIm = wasm_i32x4_shuffle(w, w, 1, 1, 3, 3);
+        v128_t xSwap = wasm_i32x4_shuffle(x, x, 1, 0, 3, 2);
+        v128_t v = wasm_f32x4_add(wasm_f32x4_mul(wRe, x),
+                                  wasm_f32x4_mul(wasm_f32x4_mul(wIm, xSwap), signs));
+
+        wasm_v128_store(loF + 2 * j, wasm_f32x4_add(u, v));
+        wasm_v128_store(hiF + 2 * j, wasm_f32x4_sub(u, v));
+    }
+#endif
+    for (; j < half; j++) {
+        const std::complex<float>& w = tw[j];
+        const std::complex<float>& x = hi[j];
+        // Plain complex multiply (std::complex operator* goes through
+        // the NaN/Inf-checking __mulsc3 helper without -ffast-math)
+        std::complex<float> v(w.real() * x.real() - w.imag() * x.imag(),
+                              w.real() * x.imag() + w.imag() * x.real());
+        std::complex<float> u = lo[j];
+
+        lo[j] = u + v;
+        hi[j] = u - v;
+    }
+}
+
+// Sliding DFT step over split re/im sums (see SlidingDft):
+// s[k] <- (s[k] - oldest) * rot[k] + newest * tail[k]
+inline void slidingDftUpdate(float* re, float* im, const float* rotRe, const float* rotIm,
+                             const float* tailRe, const float* tailIm, float oldest, float newest, int n) {
+    int k = 0;
+#ifdef __wasm_simd128__
+    const v128_t vOld = wasm_f32x4_splat(oldest);
+    const v128_t vNew = wasm_f32x4_splat(newest);
+    for (; k + 4 <= n; k += 4) {
+        v128_t r = wasm_f32x4_sub(wasm_v128_load(re + k), vOld);
+        v128_t i = wasm_v128_load(im + k);
+        v128_t cr = wasm_v128_load(rotRe + k);
+        v128_t ci = wasm_v128_load(rotIm + k);
+        v128_t outRe = wasm_f32x4_sub(wasm_f32x4_mul(r, cr), wasm_f32x4_mul(i, ci));
+        v128_t outIm = wasm_f32x4_add(wasm_f32x4_mul(r, ci), wasm_f32x4_mul(i, cr));
+        wasm_v128_store(re + k, wasm_f32x4_add(outRe, wasm_f32x4_mul(vNew, wasm_v128_load(tailRe + k))));
+        wasm_v128_store(im + k, wasm_f32x4_add(outIm, wasm_f32x4_mul(vNew, wasm_v128_load(tailIm + k))));
+    }
+#endif
+    for (; k < n; k++) {
+        float r = re[k] - oldest;
+        float i = im[k];
+        re[k] = (r * rotRe[k] - i * rotIm[k]) + newest * tailRe[k];
+        im[k] = (r * rotIm[k] + i * rotRe[k]) + newest * tailIm[k];
+    }
+}
+
+// data[i] = log(max(data[i], floor)), through libm (Exact) or fast_math::log (Fast)
+template <Precision P>
+inline void logFloor(float* data, float floor, int n) {
+    int i = 0;
+    if (P == Precision::Fast) {
+#ifdef __wasm_simd128__
+        const v128_t vFloor = wasm_f32x4_splat(floor);
+        const v128_t sqrtHalf = wasm_i32x4_splat(static_cast<int32_t>(fast_math::kSqrtHalfBits));
+        const v128_t one = wasm_f32x4_splat(1.0f);
+        const v128_t ln2 = wasm_f32x4_splat(fast_math::kLn2);
+        const v128_t c1 = wasm_f32x4_splat(2.0f);
+        const v128_t c3 = wasm_f32x4_splat(2.0f / 3.0f);
+        const v128_t c5 = wasm_f32x4_splat(2.0f / 5.0f);
+        const v128_t c7 = wasm_f32x4_splat(2.0f / 7.0f);
+        for (; i + 4 <= n; i += 4) {
+            // Same steps as fast_math::log, on four lanes
+            v128_t x = wasm_f32x4_pmax(wasm_v128_load(data + i), vFloor);
+            v128_t e = wasm_i32x4_shr(wasm_i32x4_sub(x, sqrtHalf), 23);
+            v128_t m = wasm_i32x4_sub(x, wasm_i32x4_shl(e, 23));
+            v128_t t = wasm_f32x4_div(wasm_f32x4_sub(m, one), wasm_f32x4_add(m, one));
+            v128_t t2 = wasm_f32x4_mul(t, t);
+            v128_t poly = wasm_f32x4_add(c5, wasm_f32x4_mul(t2, c7));
+            poly = wasm_f32x4_add(c3, wasm_f32x4_mul(t2, poly));
+            poly = wasm_f32x4_add(c1, wasm_f32x4_mul(t2, poly));
+            v128_t result = wasm_f32x4_add(wasm_f32x4_mul(wasm_f32x4_convert_i32x4(e), ln2),
+                                           wasm_f32x4_mul(t, poly));
+            wasm_v128_store(data + i, result);
+        }
+#endif
+        for (; i < n; i++) {
+            data[i] = fast_math::log(std::max(data[i], floor));
+        }
+    } else {
+        for (; i < n; i++) {
+            data[i] = std::log(std::max(data[i], floor));
+        }
+    }
+}
+
+}  // namespace kernels
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <vector>
+#include <complex>
+#include <cmath>
+#include <algorithm>
+
+#include "processor_config.h"
+#include "fft_plan.h"
+#include "simd_kernels.h"
+
+// Sliding DFT over the last L = frameLength samples of a stream, evaluated at
+// the N/2+1 bins of the zero-padded N = fftSize point FFT. For a frequency f
+// (cycles per sample) the sum X(f) = Σ_m x[m] e^(-2πifm) over the window
+// (m = 0 oldest) moves on by one sample with
+//   X(f) <- (X(f) - x_old) * e^(2πif) + x_new * e^(-2πif(L-1))
+// so every sample costs one complex multiply-add per tracked frequency.
+//
+// The FFT path's symmetric cosine-sum windows
+//   w[m] = a0 - a1 cos(2πmc) + a2 cos(4πmc),  c = 1/(L-1)
+// turn into a short kernel over frequencies offset by multiples of c:
+//   Xw(k/N) = a0 X(k/N) - a1/2 [X(k/N - c) + X(k/N + c)]
+//                       + a2/2 [X(k/N - 2c) + X(k/N + 2c)]
+// so besides the N/2+1 plain bins one full bank Y_d[j] = X(j/N + dc) of N
+// frequencies is tracked per cosine term, and X(k/N - dc) is read back as
+// conj(Y_d[N-k]) (real input). The spectrum matches the windowed FFT up to
+// rounding. Povey is not a cosine sum and stays on the FFT (sanitizeConfig).
+//
+// Rounding makes the running sums drift slowly, so the owner calls resync()
+// every few frames to recompute them from the frame with one FFT per bank.
+class SlidingDft {
+public:
+    SlidingDft(const ProcessorConfig& config)
+        : frameLength(config.frameLength),
+          fftSize(config.fftSize),
+          numBins(config.fftSize / 2 + 1),
+          numTerms(slidingDftCosineTerms(config.windowType)),
+          history(config.frameLength, 0.0f) {
+        // w[m] = a0 - a1 cos(2πmc) + a2 cos(4πmc)
+        double a1 = 0.0, a2 = 0.0;
+        switch (config.windowType) {
+            case WindowType::Hamming:  a0 = 0.54f; a1 = 0.46; break;
+            case WindowType::Hann:     a0 = 0.5f;  a1 = 0.5;  break;
+            case WindowType::Blackman: a0 = 0.42f; a1 = 0.5;  a2 = 0.08; break;
+            case WindowType::Povey:    a0 = 1.0f;  break;
+        }
+        termWeights[0] = static_cast<float>(-0.5 * a1);
+        termWeights[1] = static_cast<float>(0.5 * a2);
+
+        int size = numBins + numTerms * fftSize;
+        re.assign(size, 0.0f);
+        im.assign(size, 0.0f);
+        rotRe.resize(size);
+        rotIm.resize(size);
+        tailRe.resize(size);
+        tailIm.resize(size);
+        double c = frameLength > 1 ? 1.0 / (frameLength - 1) : 0.0;
+        for (int i = 0; i < size; i++) {
+            int term = i < numBins ? 0 : 1 + (i - numBins) / fftSize;
+            int j = i < numBins ? i : (i - numBins) % fftSize;
+            double f = static_cast<double>(j) / fftSize + term * c;
+            rotRe[i] = static_cast<float>(std::cos(2.0 * M_PI * f));
+            rotIm[i] = static_cast<float>(std::sin(2.0 * M_PI * f));
+            tailRe[i] = static_cast<float>(std::cos(2.0 * M_PI * f * (frameLength - 1)));
+            tailIm[i] = static_cast<float>(-std::sin(2.0 * M_PI * f * (frameLength - 1)));
+        }
+
+        // e^(-2πi d c m) per term, to shift a frame onto bank d in resync()
+        modulation.resize(static_cast<size_t>(numTerms) * frameLength);
+        for (int d = 1; d <= numTerms; d++) {
+            for (int m = 0; m < frameLength; m++) {
+                double angle = -2.0 * M_PI * d * c * m;
+                modulation[static_cast<size_t>(d - 1) * frameLength + m] =
+                    std::complex<float>(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+            }
+        }
+    }
+
+    int getFramesSinceResync() const { return framesSinceResync; }
+
+    void clear() {
+        std::fill(history.begin(), history.end(), 0.0f);
+        std::fill(re.begin(), re.end(), 0.0f);
+        std::fill(im.begin(), im.end(), 0.0f);
+        pos = 0;
+        framesSinceResync = 0;
+    }
+
+    // Slides the window forward by count samples
+    void push(const float* samples, int count) {
+        int size = static_cast<int>(re.size());
+        for (int i = 0; i < count; i++) {
+            float oldest = history[pos];
+            history[pos] = samples[i];
+            pos = pos + 1 == frameLength ? 0 : pos + 1;
+            kernels::slidingDftUpdate(re.data(), im.data(), rotRe.data(), rotIm.data(), tailRe.data(),
+                                      tailIm.data(), oldest, samples[i], size);
+        }
+    }
+
+    // Replaces the running sums with exact transforms of frame, which must be
+    // the frameLength samples the window currently covers (oldest first).
+    // plan is the fftSize-point complex plan, scratch holds fftSize values.
+    void resync(const float* frame, const FftPlan& plan, std::complex<float>* scratch) {
+        for (int term = 0; term <= numTerms; term++) {
+            const std::complex<float>* shift =
+                term > 0 ? modulation.data() + static_cast<size_t>(term - 1) * frameLength : nullptr;
+            for (int m = 0; m < frameLength; m++) {
+                scratch[m] = shift ? frame[m] * shift[m] : std::complex<float>(frame[m], 0.0f);
+            }
+            std::fill(scratch + frameLength, scratch + fftSize, std::complex<float>(0.0f, 0.0f));
+            plan.execute(scratch);
+
+            int begin = term == 0 ? 0 : numBins + (term - 1) * fftSize;
+            int count = term == 0 ? numBins : fftSize;
+            for (int j = 0; j < count; j++) {
+                re[begin + j] = scratch[j].real();
+                im[begin + j] = scratch[j].imag();
+            }
+        }
+        framesSinceResync = 0;
+    }
+
+    // Writes the windowed spectrum of the current frameLength samples to out
+    // (fftSize/2+1 bins), ready for the power spectrum stage
+    void windowedSpectrum(std::complex<float>* out) {
+        for (int k = 0; k < numBins; k++) {
+            float outRe = a0 * re[k];
+            float outIm = a0 * im[k];
+            for (int term = 0; term < numTerms; term++) {
+                // X(k/N + dc) + X(k/N - dc) = Y_d[k] + conj(Y_d[N-k])
+                const float* bankRe = re.data() + numBins + term * fftSize;
+                const float* bankIm = im.data() + numBins + term * fftSize;
+                int mirror = k == 0 ? 0 : fftSize - k;
+                outRe += termWeights[term] * (bankRe[k] + bankRe[mirror]);
+                outIm += termWeights[term] * (bankIm[k] - bankIm[mirror]);
+            }
+            out[k] = std::complex<float>(outRe, outIm);
+        }
+        framesSinceResync++;
+    }
+
+private:
+    int frameLength;
+    int fftSize;
+    int numBins;
+    int numTerms;                 // cosine terms of the window, one bank each
+    float a0 = 1.0f;
+    float termWeights[2] = {};    // -a1/2, a2/2
+    std::vector<float> history;   // last frameLength samples, circular
+    int pos = 0;
+    // Plain bins, then one fftSize bank per cosine term, split re/im
+    std::vector<float> re;
+    std::vector<float> im;
+    std::vector<float> rotRe;     // e^(2πif)
+    std::vector<float> rotIm;
+    std::vector<float> tailRe;    // e^(-2πif(L-1)), weight of the newest sample
+    std::vector<float> tailIm;
+    std::vector<std::complex<float>> modulation;
+    int framesSinceResync = 0;
+};
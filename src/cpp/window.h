@@ -0,0 +1,37 @@
+#pragma once
+
+#include <vector>
+#include <cmath>
+
+#include "processor_config.h"
+#include "baked_tables.h"
+
+// Analysis window table for one frame length, evaluated once per config so
+// switching window types costs nothing per frame.
+inline std::vector<float> buildWindow(WindowType type, int n) {
+    if (const float* baked = baked_tables::window(type, n)) return std::vector<float>(baked, baked + n);
+
+    std::vector<float> window(n, 1.0f);
+    if (n < 2) return window;
+
+    for (int i = 0; i < n; i++) {
+        double phase = 2.0 * M_PI * i / (n - 1);
+        switch (type) {
+            case WindowType::Hamming:
+                // Hamming window: 0.54 - 0.46 * cos(2πi/(n-1))
+                window[i] = 0.54f - 0.46f * std::cos(2.0f * M_PI * i / (n - 1));
+                break;
+            case WindowType::Hann:
+                window[i] = static_cast<float>(0.5 - 0.5 * std::cos(phase));
+                break;
+            case WindowType::Blackman:
+                window[i] = static_cast<float>(0.42 - 0.5 * std::cos(phase) + 0.08 * std::cos(2.0 * phase));
+                break;
+            case WindowType::Povey:
+                // Kaldi's default: Hann raised to 0.85, close to Hamming but zero at the edges
+                window[i] = static_cast<float>(std::pow(0.5 - 0.5 * std::cos(phase), 0.85));
+                break;
+        }
+    }
+    return window;
+}
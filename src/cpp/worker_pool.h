@@ -0,0 +1,100 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of persistent threads that split an index range between them.
+// The calling thread takes part as worker 0, so a pool of size N starts N-1
+// threads. run() blocks until every range is done. On the web these are
+// Emscripten pthreads (Web Workers), natively std::threads.
+class WorkerPool {
+public:
+    // fn(ctx, begin, end, worker) processes indices [begin, end) on `worker`
+    using RangeFn = void (*)(void* ctx, int begin, int end, int worker);
+
+    explicit WorkerPool(int numWorkers) : numWorkers(numWorkers < 1 ? 1 : numWorkers) {
+        for (int w = 1; w < this->numWorkers; w++) {
+            threads.emplace_back([this, w]() { workerLoop(w); });
+        }
+    }
+
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        startCv.notify_all();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    int size() const { return numWorkers; }
+
+    // Splits [0, count) into size() contiguous ranges and runs them in parallel.
+    // Not reentrant: one run() at a time per pool.
+    void run(int count, RangeFn fn, void* ctx) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job = {count, fn, ctx};
+            pending = numWorkers - 1;
+            generation++;
+        }
+        startCv.notify_all();
+
+        runRange(0);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        doneCv.wait(lock, [this]() { return pending == 0; });
+    }
+
+private:
+    struct Job {
+        int count = 0;
+        RangeFn fn = nullptr;
+        void* ctx = nullptr;
+    };
+
+    int numWorkers;
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable startCv;
+    std::condition_variable doneCv;
+    Job job;
+    unsigned generation = 0;
+    int pending = 0;
+    bool stopping = false;
+
+    void runRange(int worker) {
+        int begin = static_cast<int>(static_cast<long long>(job.count) * worker / numWorkers);
+        int end = static_cast<int>(static_cast<long long>(job.count) * (worker + 1) / numWorkers);
+        if (begin < end) {
+            job.fn(job.ctx, begin, end, worker);
+        }
+    }
+
+    void workerLoop(int worker) {
+        unsigned seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                startCv.wait(lock, [&]() { return stopping || generation != seen; });
+                if (stopping) return;
+                seen = generation;
+            }
+
+            runRange(worker);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                pending--;
+            }
+            doneCv.notify_one();
+        }
+    }
+};
@@ -2,8 +2,12 @@
 import React from 'react'
 import ReactDOM from 'react-dom/client'
 import App from './App.jsx'
+import { loadSignalProcessor } from './wasmLoader'
 import './index.css'
 
+// Start fetching and compiling the WASM module before the first render
+loadSignalProcessor()
+
 ReactDOM.createRoot(document.getElementById('root')).render(
   <React.StrictMode>
     <App />
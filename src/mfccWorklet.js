@@ -0,0 +1,85 @@
+/**
+ * Main-thread side of the AudioWorklet MFCC path.
+ * Compiles the worklet WASM build, starts the processor node and hands back a
+ * reader for the SharedArrayBuffer frame ring it writes into, plus the shared
+ * display history when one was requested.
+ */
+import workletUrl from './mfccWorkletProcessor.js?worker&url';
+import {
+  createFrameRing,
+  FrameRingReader,
+  createSharedHistory,
+  SharedHistoryReader,
+} from './sharedFrameRing.js';
+
+const wasmUrl = new URL('./wasm/signal_processor_worklet.wasm', import.meta.url);
+
+/**
+ * SharedArrayBuffer needs a cross-origin isolated page (see the COOP/COEP
+ * headers in vite.config.js); without it the caller keeps the main-thread loop.
+ */
+export function workletSupported(audioContext) {
+  return typeof SharedArrayBuffer !== 'undefined' &&
+    window.crossOriginIsolated === true &&
+    !!audioContext.audioWorklet;
+}
+
+/**
+ * @param {AudioContext} audioContext
+ * @param {AudioNode} source - Node to analyse
+ * @param {object} config - ProcessorConfig overrides (sampleRate is taken from the context)
+ * @param {object} [display]
+ * @param {number} [display.historyLength=0] - Rows of the shared display history, 0 for none
+ * @param {boolean} [display.quantized=false] - Also mirror the uint8 rows (UNSIGNED_BYTE textures)
+ * @returns {Promise<{node: AudioWorkletNode, reader: FrameRingReader,
+ *   history: SharedHistoryReader|null, config: object,
+ *   setInstrumentationEnabled: function(boolean): void,
+ *   setHistoryMapping: function(object): void}>}
+ */
+export async function createMfccWorklet(audioContext, source, config = {}, display = {}) {
+  const { historyLength = 0, quantized = false } = display;
+  const [wasmModule] = await Promise.all([
+    WebAssembly.compileStreaming(fetch(wasmUrl)),
+    audioContext.audioWorklet.addModule(workletUrl),
+  ]);
+
+  // One ring slot per output frame: statics plus any delta columns
+  const frameWidth = (config.numCoeffs ?? 13) * (1 + (config.deltaOrder ?? 0));
+  const frameRing = createFrameRing(frameWidth);
+  // The history holds display rows of the statics only
+  const historySab = historyLength > 0 ? createSharedHistory(config.numCoeffs ?? 13, historyLength) : null;
+
+  const node = new AudioWorkletNode(audioContext, 'mfcc-processor', {
+    numberOfInputs: 1,
+    numberOfOutputs: 0,
+    channelCount: 1,
+    channelCountMode: 'explicit',
+    processorOptions: {
+      wasmModule,
+      frameRing,
+      history: historySab ? { sab: historySab, quantized } : null,
+      config: { ...config, sampleRate: audioContext.sampleRate },
+    },
+  });
+
+  // Wait for the processor to instantiate WASM before we start reading
+  const readyConfig = await new Promise((resolve, reject) => {
+    node.port.onmessage = ({ data }) => {
+      if (data.type === 'ready') resolve(data.config);
+      else if (data.type === 'error') reject(new Error(data.message));
+    };
+  });
+
+  source.connect(node);
+  return {
+    node,
+    reader: new FrameRingReader(frameRing),
+    history: historySab ? new SharedHistoryReader(historySab) : null,
+    config: readyConfig,
+    // Perf counters live in the worklet; the reader sees them as reader.stats
+    setInstrumentationEnabled: (enabled) => node.port.postMessage({ type: 'instrumentation', enabled }),
+    // { mode, minValue, maxValue, coefficients: [{ scale, offset }] }: the
+    // NormalizationMode name and FixedRange mapping of the worklet's history
+    setHistoryMapping: (mapping) => node.port.postMessage({ type: 'historyMapping', mapping }),
+  };
+}
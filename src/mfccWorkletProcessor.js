@@ -0,0 +1,95 @@
+/**
+ * AudioWorkletProcessor hosting the WASM SignalProcessor off the main thread.
+ * Every 128-sample render quantum is pushed into the streaming frame engine and
+ * the resulting coefficient frames are published through a SharedArrayBuffer ring.
+ * With a shared history the processor also keeps its WASM display history and
+ * mirrors the new rows into it for the renderer.
+ */
+import createModule from './wasm/signal_processor_worklet.js';
+import { FrameRingWriter, SharedHistoryWriter } from './sharedFrameRing.js';
+
+class MfccWorkletProcessor extends AudioWorkletProcessor {
+  constructor(options) {
+    super();
+    const { wasmModule, config, frameRing, history } = options.processorOptions;
+
+    this.processor = null;
+    this.ring = new FrameRingWriter(frameRing);
+    this.history = history ? new SharedHistoryWriter(history.sab) : null;
+    this.quantized = !!(history && history.quantized);
+    this.instrumented = false;
+    // Latest display mapping from the main thread, applied once WASM is ready
+    this.mapping = null;
+
+    // The main thread toggles the perf counters; they are mirrored into the ring
+    this.port.onmessage = ({ data }) => {
+      if (data.type === 'instrumentation') {
+        this.instrumented = data.enabled;
+        if (this.processor) this.processor.setInstrumentationEnabled(data.enabled);
+      } else if (data.type === 'historyMapping') {
+        this.mapping = data.mapping;
+        this.applyMapping();
+      }
+    };
+
+    // The main thread already compiled the module, instantiate it synchronously here
+    createModule({
+      instantiateWasm(imports, onInstance) {
+        const instance = new WebAssembly.Instance(wasmModule, imports);
+        onInstance(instance, wasmModule);
+        return instance.exports;
+      },
+    }).then((Module) => {
+      this.Module = Module;
+      this.processor = new Module.SignalProcessor({ ...Module.getDefaultConfig(), ...config });
+      if (this.history) {
+        // History buffers are allocated here, so the views below stay valid
+        this.processor.setHistoryLength(this.history.numRows);
+        this.processor.setHistoryQuantized(this.quantized);
+        this.historyValues = this.processor.getHistoryView();
+        this.historyBytes = this.quantized ? this.processor.getHistoryBytesView() : null;
+        this.applyMapping();
+      }
+      this.streamInput = this.processor.getStreamInputView();
+      this.streamOutput = this.processor.getStreamOutputView();
+      this.streamInputPtr = this.processor.getStreamInputPtr();
+      this.perfStats = this.processor.getPerfStatsView();
+      this.processor.setInstrumentationEnabled(this.instrumented);
+      this.port.postMessage({ type: 'ready', config: this.processor.getConfig() });
+    }).catch((err) => {
+      this.port.postMessage({ type: 'error', message: err.message });
+    });
+  }
+
+  applyMapping() {
+    if (!this.processor || !this.history || !this.mapping) return;
+    const { mode, minValue, maxValue, coefficients } = this.mapping;
+    // Switching modes restarts the running statistics, so only on a change
+    const normalizationMode = this.Module.NormalizationMode[mode];
+    if (normalizationMode && this.processor.getNormalizationMode() !== normalizationMode) {
+      this.processor.setNormalizationMode(normalizationMode);
+    }
+    this.processor.setHistoryRange(minValue, maxValue);
+    coefficients.forEach(({ scale, offset }, k) => this.processor.setHistoryMapping(k, scale, offset));
+  }
+
+  process(inputs) {
+    const channel = inputs[0] && inputs[0][0];
+    if (!this.processor || !channel) return true;
+
+    this.streamInput.set(channel);
+    const frames = this.processor.pushSamples(this.streamInputPtr, channel.length);
+    if (frames > 0) {
+      this.ring.push(this.streamOutput, frames);
+      if (this.history) {
+        this.history.update(this.historyValues, this.historyBytes, this.processor.getHistoryFramesWritten());
+      }
+      if (this.instrumented) {
+        this.ring.publishStats(this.perfStats);
+      }
+    }
+    return true;
+  }
+}
+
+registerProcessor('mfcc-processor', MfccWorkletProcessor);
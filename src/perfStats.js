@@ -0,0 +1,73 @@
+/**
+ * Field layout of the SignalProcessor PerfStats Float64Array
+ * (keep in sync with src/cpp/perf_stats.h).
+ */
+export const PerfField = {
+  FRAMES: 0,
+  FFT_MS: 1,
+  POWER_MS: 2,
+  MEL_MS: 3,
+  LOG_MS: 4,
+  DCT_MS: 5,
+  TOTAL_MS: 6,
+  MAX_FRAME_MS: 7,
+  LAST_FRAME_MS: 8,
+  DROPPED_FRAMES: 9,
+};
+export const PERF_STATS_FIELDS = 10;
+
+const STAGES = [
+  ['fft', PerfField.FFT_MS],
+  ['power', PerfField.POWER_MS],
+  ['mel', PerfField.MEL_MS],
+  ['log', PerfField.LOG_MS],
+  ['dct', PerfField.DCT_MS],
+];
+
+/**
+ * Accumulates the JS side of the frame path (marshalling and rendering) next
+ * to the WASM counters and turns both into per-frame averages per interval.
+ */
+export class PerfMonitor {
+  constructor() {
+    this.previous = new Float64Array(PERF_STATS_FIELDS);
+    this.marshalMs = 0;
+    this.renderMs = 0;
+    this.jsFrames = 0;
+  }
+
+  addMarshal(ms) { this.marshalMs += ms; }
+
+  addRender(ms) {
+    this.renderMs += ms;
+    this.jsFrames++;
+  }
+
+  /**
+   * @param {Float64Array} stats - Current processor counters
+   * @param {number} overruns - Frames the UI skipped in the shared frame ring
+   * @returns {object} Per-frame averages (ms) since the previous call
+   */
+  snapshot(stats, overruns = 0) {
+    const frames = stats[PerfField.FRAMES] - this.previous[PerfField.FRAMES];
+    const perFrame = (field) => frames > 0 ? (stats[field] - this.previous[field]) / frames : 0;
+    const perJsFrame = (ms) => this.jsFrames > 0 ? ms / this.jsFrames : 0;
+
+    const result = {
+      frames,
+      stages: Object.fromEntries(STAGES.map(([name, field]) => [name, perFrame(field)])),
+      dspMs: perFrame(PerfField.TOTAL_MS),
+      maxFrameMs: stats[PerfField.MAX_FRAME_MS],
+      marshalMs: perJsFrame(this.marshalMs),
+      renderMs: perJsFrame(this.renderMs),
+      dropped: stats[PerfField.DROPPED_FRAMES],
+      overruns,
+    };
+
+    this.previous.set(stats);
+    this.marshalMs = 0;
+    this.renderMs = 0;
+    this.jsFrames = 0;
+    return result;
+  }
+}
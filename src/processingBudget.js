@@ -0,0 +1,106 @@
+/**
+ * Adaptive quality for the main-thread processing loop.
+ * Each tier is a processor shape plus how many animation frames pass between
+ * processed frames. The scheduler averages the per-frame cost (wall time the
+ * loop measures around the analyser copy, the WASM call and the upload, so
+ * the per-stage PerfStats counters can stay off) and steps down a tier while
+ * the average is over budget, and back up once a lower cost has held for a
+ * while, so a slow device gets a coarser picture instead of a stalled UI
+ * thread.
+ */
+
+/** Highest quality first. numCoeffs stays at 13 so the renderer and history keep their shape. */
+export const QUALITY_TIERS = [
+  { name: 'full', frameLength: 1024, fftSize: 1024, numBands: 40, frameStride: 1 },
+  { name: 'reduced bands', frameLength: 1024, fftSize: 1024, numBands: 26, frameStride: 1 },
+  { name: 'small FFT', frameLength: 512, fftSize: 512, numBands: 26, frameStride: 1 },
+  { name: 'half rate', frameLength: 512, fftSize: 512, numBands: 26, frameStride: 2 },
+  { name: 'minimal', frameLength: 256, fftSize: 256, numBands: 20, frameStride: 3 },
+];
+
+export class ProcessingBudget {
+  /**
+   * @param {object} [options]
+   * @param {number} [options.budgetMs=4] - Per processed frame, DSP plus JS
+   * @param {number} [options.headroom=0.5] - Step up when the average is below budgetMs * headroom
+   * @param {number} [options.downFrames=20] - Processed frames averaged before stepping down
+   * @param {number} [options.upFrames=120] - Processed frames under the headroom before stepping up
+   *   (doubled, up to 16x, after every step up that had to be undone)
+   * @param {function(object, number): void} [options.onTierChange] - Called with (tier, index)
+   */
+  constructor({ budgetMs = 4, headroom = 0.5, downFrames = 20, upFrames = 120, onTierChange = null } = {}) {
+    this.budgetMs = budgetMs;
+    this.headroom = headroom;
+    this.downFrames = downFrames;
+    this.upFrames = upFrames;
+    this.onTierChange = onTierChange;
+    // Grows each time a step up has to be undone, so a tier that cannot be
+    // held is retried less and less often
+    this.upDelay = upFrames;
+    this.steppedUp = false;
+    this.tierIndex = 0;
+    this.skip = 0;
+    this.resetWindow();
+  }
+
+  get tier() { return QUALITY_TIERS[this.tierIndex]; }
+
+  resetWindow() {
+    this.windowMs = 0;
+    this.windowFrames = 0;
+    this.underFrames = 0;
+  }
+
+  /**
+   * Call once per animation frame.
+   * @returns {boolean} Whether to run the processor this frame
+   */
+  shouldProcess() {
+    if (this.skip > 0) {
+      this.skip--;
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * Records one processed frame.
+   * @param {number} costMs - Wall time of the frame: analyser copy, DSP and upload
+   * @returns {boolean} True when the tier changed and the processor must be rebuilt
+   */
+  record(costMs) {
+    // Frame skipping: a frame far over budget pays for itself with idle frames
+    const overrun = Math.min(3, Math.ceil(costMs / this.budgetMs) - 1);
+    this.skip = Math.max(this.tier.frameStride - 1, overrun);
+
+    this.windowMs += costMs;
+    this.windowFrames++;
+    this.underFrames = costMs < this.budgetMs * this.headroom ? this.underFrames + 1 : 0;
+
+    if (this.windowFrames >= this.downFrames) {
+      const averageMs = this.windowMs / this.windowFrames;
+      this.windowMs = 0;
+      this.windowFrames = 0;
+      if (averageMs > this.budgetMs && this.tierIndex < QUALITY_TIERS.length - 1) {
+        if (this.steppedUp) this.upDelay = Math.min(this.upDelay * 2, this.upFrames * 16);
+        this.steppedUp = false;
+        return this.setTier(this.tierIndex + 1);
+      }
+      // A full window within budget: the last step up has held
+      this.steppedUp = false;
+    }
+    if (this.underFrames >= this.upDelay && this.tierIndex > 0) {
+      this.steppedUp = true;
+      return this.setTier(this.tierIndex - 1);
+    }
+    return false;
+  }
+
+  setTier(index) {
+    this.tierIndex = index;
+    this.skip = 0;
+    this.resetWindow();
+    if (this.onTierChange) this.onTierChange(this.tier, index);
+    return true;
+  }
+}
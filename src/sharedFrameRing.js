@@ -0,0 +1,171 @@
+/**
+ * Single-producer / single-consumer ring of coefficient frames in a SharedArrayBuffer.
+ * The audio worklet writes frames as they are produced and the UI thread reads
+ * them on its own schedule, so no postMessage is needed per frame.
+ *
+ * Layout: Int32 header [framesWritten, numCoeffs, capacity, unused], then the
+ * processor's PerfStats as PERF_STATS_FIELDS Float64 values, then
+ * capacity * numCoeffs Float32 values.
+ */
+import { PERF_STATS_FIELDS } from './perfStats.js';
+
+const HEADER_INTS = 4;
+const HEADER_BYTES = HEADER_INTS * Int32Array.BYTES_PER_ELEMENT;
+const STATS_BYTES = PERF_STATS_FIELDS * Float64Array.BYTES_PER_ELEMENT;
+const DATA_OFFSET = HEADER_BYTES + STATS_BYTES;
+
+export function createFrameRing(numCoeffs, capacity = 256) {
+  const sab = new SharedArrayBuffer(DATA_OFFSET + capacity * numCoeffs * Float32Array.BYTES_PER_ELEMENT);
+  const header = new Int32Array(sab, 0, HEADER_INTS);
+  header[1] = numCoeffs;
+  header[2] = capacity;
+  return sab;
+}
+
+export class FrameRingWriter {
+  constructor(sab) {
+    this.header = new Int32Array(sab, 0, HEADER_INTS);
+    this.numCoeffs = this.header[1];
+    this.capacity = this.header[2];
+    this.stats = new Float64Array(sab, HEADER_BYTES, PERF_STATS_FIELDS);
+    this.data = new Float32Array(sab, DATA_OFFSET, this.capacity * this.numCoeffs);
+    this.written = Atomics.load(this.header, 0);
+  }
+
+  /**
+   * Append frameCount frames stored back to back in source
+   * @param {Float32Array} source - numCoeffs floats per frame
+   */
+  push(source, frameCount) {
+    for (let f = 0; f < frameCount; f++) {
+      const slot = (this.written % this.capacity) * this.numCoeffs;
+      const offset = f * this.numCoeffs;
+      for (let i = 0; i < this.numCoeffs; i++) {
+        this.data[slot + i] = source[offset + i];
+      }
+      this.written++;
+    }
+    // Publish after the data so the reader never sees a half written frame count
+    Atomics.store(this.header, 0, this.written);
+  }
+
+  /**
+   * Copy the processor's PerfStats into the shared block. The values are plain
+   * stores, so the reader may see a mix of two updates; fine for an overlay.
+   * @param {Float64Array} source - SignalProcessor.getPerfStatsView()
+   */
+  publishStats(source) {
+    this.stats.set(source);
+  }
+}
+
+export class FrameRingReader {
+  constructor(sab) {
+    this.header = new Int32Array(sab, 0, HEADER_INTS);
+    this.numCoeffs = this.header[1];
+    this.capacity = this.header[2];
+    this.stats = new Float64Array(sab, HEADER_BYTES, PERF_STATS_FIELDS);
+    this.data = new Float32Array(sab, DATA_OFFSET, this.capacity * this.numCoeffs);
+    this.read = Atomics.load(this.header, 0);
+    this.overruns = 0;
+    // Preallocated views into every slot so reading allocates nothing
+    this.slots = [];
+    for (let s = 0; s < this.capacity; s++) {
+      this.slots.push(this.data.subarray(s * this.numCoeffs, (s + 1) * this.numCoeffs));
+    }
+  }
+
+  /**
+   * Call onFrame(frameView) for every frame published since the last call.
+   * If the reader fell more than capacity frames behind, the oldest frames are skipped.
+   * @returns {number} Number of frames delivered
+   */
+  drain(onFrame) {
+    const written = Atomics.load(this.header, 0);
+    if (written - this.read > this.capacity) {
+      this.overruns += written - this.read - this.capacity;
+      this.read = written - this.capacity;
+    }
+    const count = written - this.read;
+    for (; this.read < written; this.read++) {
+      onFrame(this.slots[this.read % this.capacity]);
+    }
+    return count;
+  }
+}
+
+const HISTORY_HEADER_INTS = 4;
+const HISTORY_HEADER_BYTES = HISTORY_HEADER_INTS * Int32Array.BYTES_PER_ELEMENT;
+
+/**
+ * Display history of the worklet's SignalProcessor mirrored into a
+ * SharedArrayBuffer, so the UI thread uploads rows normalized in WASM without
+ * touching individual values.
+ *
+ * Layout: Int32 header [framesWritten, numCoeffs, numRows, unused], then
+ * numRows * numCoeffs Float32 display values in the FeatureHistory texture
+ * layout, then the same rows as uint8 codes (filled when the processor
+ * quantizes its history). As in FeatureHistory the next row to be written is
+ * framesWritten % numRows, so the count alone describes the buffer.
+ */
+export function createSharedHistory(numCoeffs, numRows) {
+  const values = numRows * numCoeffs;
+  const sab = new SharedArrayBuffer(HISTORY_HEADER_BYTES + values * (Float32Array.BYTES_PER_ELEMENT + 1));
+  const header = new Int32Array(sab, 0, HISTORY_HEADER_INTS);
+  header[1] = numCoeffs;
+  header[2] = numRows;
+  return sab;
+}
+
+function historyViews(target, sab) {
+  target.header = new Int32Array(sab, 0, HISTORY_HEADER_INTS);
+  target.numCoeffs = target.header[1];
+  target.numRows = target.header[2];
+  const count = target.numCoeffs * target.numRows;
+  target.values = new Float32Array(sab, HISTORY_HEADER_BYTES, count);
+  target.bytes = new Uint8Array(sab, HISTORY_HEADER_BYTES + count * Float32Array.BYTES_PER_ELEMENT, count);
+}
+
+export class SharedHistoryWriter {
+  constructor(sab) {
+    historyViews(this, sab);
+    this.copied = 0;
+  }
+
+  /**
+   * Copy the rows the processor wrote since the last call.
+   * @param {Float32Array} values - SignalProcessor.getHistoryView()
+   * @param {Uint8Array|null} bytes - getHistoryBytesView() of a quantized history
+   * @param {number} framesWritten - SignalProcessor.getHistoryFramesWritten()
+   */
+  update(values, bytes, framesWritten) {
+    // A cleared history starts counting from zero again
+    if (framesWritten < this.copied) this.copied = 0;
+    const pending = Math.min(framesWritten - this.copied, this.numRows);
+    const count = this.numCoeffs;
+    for (let f = framesWritten - pending; f < framesWritten; f++) {
+      const begin = (f % this.numRows) * count;
+      for (let i = begin; i < begin + count; i++) {
+        this.values[i] = values[i];
+      }
+      if (bytes) {
+        for (let i = begin; i < begin + count; i++) {
+          this.bytes[i] = bytes[i];
+        }
+      }
+    }
+    this.copied = framesWritten;
+    // Publish after the rows, as FrameRingWriter.push does
+    Atomics.store(this.header, 0, framesWritten);
+  }
+}
+
+export class SharedHistoryReader {
+  constructor(sab) {
+    historyViews(this, sab);
+  }
+
+  get framesWritten() {
+    return Atomics.load(this.header, 0);
+  }
+}
@@ -0,0 +1,66 @@
+/**
+ * Loads the main-thread signal processor module.
+ * The SIMD or scalar .wasm is streamed into WebAssembly.compileStreaming while
+ * its glue script is still being imported, and the glue then instantiates the
+ * already compiled module instead of fetching the binary itself. main.jsx
+ * starts this before React renders, so the download and compile overlap
+ * app start-up; later callers get the same promise.
+ */
+
+const scalarWasmUrl = new URL('./wasm/signal_processor.wasm', import.meta.url);
+const simdWasmUrl = new URL('./wasm/signal_processor_simd.wasm', import.meta.url);
+
+/** Smallest module using a v128 instruction; validates only with WASM SIMD support */
+export function simdSupported() {
+  return WebAssembly.validate(new Uint8Array([
+    0, 97, 115, 109, 1, 0, 0, 0, 1, 5, 1, 96, 0, 1, 123, 3, 2, 1, 0,
+    10, 10, 1, 8, 0, 65, 0, 253, 15, 253, 98, 11
+  ]));
+}
+
+async function compileWasm(url) {
+  try {
+    return await WebAssembly.compileStreaming(fetch(url));
+  } catch (err) {
+    // compileStreaming needs the application/wasm MIME type; compile from
+    // the downloaded bytes when the server sends something else
+    console.warn('Streaming WASM compilation unavailable, compiling from bytes:', err);
+    const response = await fetch(url);
+    return WebAssembly.compile(await response.arrayBuffer());
+  }
+}
+
+let modulePromise = null;
+
+/**
+ * @returns {Promise<{Module: object, simd: boolean}>} The embind module and
+ *   whether it is the SIMD128 build
+ */
+export function loadSignalProcessor() {
+  if (!modulePromise) {
+    modulePromise = (async () => {
+      const simd = simdSupported();
+      const [wasmModule, moduleFactory] = await Promise.all([
+        compileWasm(simd ? simdWasmUrl : scalarWasmUrl),
+        simd ? import('./wasm/signal_processor_simd.js') : import('./wasm/signal_processor.js'),
+      ]);
+
+      let rejectInstance;
+      const instanceFailed = new Promise((resolve, reject) => { rejectInstance = reject; });
+      const Module = await Promise.race([
+        moduleFactory.default({
+          instantiateWasm(imports, onInstance) {
+            WebAssembly.instantiate(wasmModule, imports)
+              .then((instance) => onInstance(instance, wasmModule), rejectInstance);
+            return {};
+          },
+        }),
+        instanceFailed,
+      ]);
+      return { Module, simd };
+    })();
+    // Let a later call retry after a failed load
+    modulePromise.catch(() => { modulePromise = null; });
+  }
+  return modulePromise;
+}
@@ -2,17 +2,28 @@
  * WebGL-based renderer for cepstral coefficients
  * High-performance solution for rendering live spectrograms
  */
+
+// Entries in the colormap texture
+const COLORMAP_SIZE = 256;
+
 export class WebGLSpectrogramRenderer {
   constructor(canvasElement, options = {}) {
     this.canvas = canvasElement;
     
-    // Try to get WebGL context with various options for better compatibility
+    // Prefer WebGL2 for single-channel float textures; a canvas keeps the
+    // context type it was first asked for, so renderers recreated on the same
+    // canvas stay on the same backend
     try {
-      this.gl = canvasElement.getContext('webgl', { 
+      const attributes = { 
         alpha: false,
         antialias: false,
         powerPreference: 'high-performance'
-      }) || canvasElement.getContext('experimental-webgl');
+      };
+      this.gl = (options.preferWebGL2 !== false && canvasElement.getContext('webgl2', attributes)) || null;
+      this.isWebGL2 = !!this.gl;
+      if (!this.gl) {
+        this.gl = canvasElement.getContext('webgl', attributes) || canvasElement.getContext('experimental-webgl');
+      }
       
       if (!this.gl) {
         throw new Error('WebGL not supported');
@@ -32,12 +43,29 @@ export class WebGLSpectrogramRenderer {
       minValue: -100,                // Min expected coefficient value
       maxValue: 100,                 // Max expected coefficient value
       normalizeFunction: null,       // Optional custom normalization function
+      preferWebGL2: true,            // Use the WebGL2 backend when available
+      halfFloat: false,              // WebGL2: R16F instead of R32F history texture
       ...options
     };
     
-    // Flag for texture type (set in initTexture)
+    // Flag for texture type (set in initTexture); never set on WebGL2, where
+    // the history texture is R32F/R16F
     this.useUint8 = false;
     
+    // The texture holds one row of coefficientCount texels per frame (C0 in
+    // the last texel) and its rows are a circular buffer: each frame
+    // overwrites the oldest row and the shader scrolls by writeRow, so nothing
+    // is shifted. This is also the layout of the WASM history buffer.
+    this.writeRow = 0;
+    this.row = new Float32Array(this.options.coefficientCount);
+    this.rowUint8 = new Uint8Array(this.options.coefficientCount * this.options.historyLength);
+    
+    // Heap-resident history (see attachHistory), null when fed through updateData
+    this.history = null;
+    this.historyQuantized = false;
+    this.historyRows = null;
+    this.historyUploaded = 0;
+    
     // Initialize data storage
     this.data = new Float32Array(this.options.coefficientCount * this.options.historyLength);
     
@@ -46,11 +74,13 @@ export class WebGLSpectrogramRenderer {
       this.data[i] = 0;
     }
     this.dataTexture = null;
+    this.colormapTexture = null;
     
     // Initialize WebGL
     this.initShaders();
     this.initBuffers();
     this.initTexture();
+    this.initColormap();
     
     // Set initial viewport
     this.gl.viewport(0, 0, this.canvas.width, this.canvas.height);
@@ -66,7 +96,15 @@ export class WebGLSpectrogramRenderer {
    */
   initShaders() {
     // Vertex shader - positions the quad for rendering
-    const vsSource = `
+    const vsSource = this.isWebGL2 ? `#version 300 es
+      in vec4 aVertexPosition;
+      in vec2 aTextureCoord;
+      out highp vec2 vTextureCoord;
+      void main(void) {
+        gl_Position = aVertexPosition;
+        vTextureCoord = aTextureCoord;
+      }
+    ` : `
       attribute vec4 aVertexPosition;
       attribute vec2 aTextureCoord;
       varying highp vec2 vTextureCoord;
@@ -76,35 +114,49 @@ export class WebGLSpectrogramRenderer {
       }
     `;
 
-    // Fragment shader - colors pixels based on data values
-    const fsSource = `
+    // Fragment shader - normalizes the data value and looks its color up in
+    // the colormap texture (see initColormap)
+    const fsSource = this.isWebGL2 ? `#version 300 es
+      precision mediump float;
+      in highp vec2 vTextureCoord;
+      // R32F texels keep their full precision only through a highp sampler
+      uniform highp sampler2D uSampler;
+      uniform sampler2D uColormap;
+      uniform float uMinValue;
+      uniform float uMaxValue;
+      // Texture row of the oldest frame divided by historyLength
+      uniform highp float uScrollOffset;
+      // Maps [0, 1] onto the colormap texel centers
+      uniform vec2 uColormapScale;
+      out vec4 fragColor;
+      
+      void main(void) {
+        // Frames are texture rows: the on-screen column picks the row in the
+        // circular buffer, the on-screen row picks the coefficient texel
+        highp vec2 coord = vec2(vTextureCoord.y, fract(vTextureCoord.x + uScrollOffset));
+        float value = texture(uSampler, coord).r;
+        float normalizedValue = clamp((value - uMinValue) / (uMaxValue - uMinValue), 0.0, 1.0);
+        fragColor = texture(uColormap, vec2(normalizedValue * uColormapScale.x + uColormapScale.y, 0.5));
+      }
+    ` : `
       precision mediump float;
       varying highp vec2 vTextureCoord;
       uniform sampler2D uSampler;
-      uniform vec4 uColorLow;
-      uniform vec4 uColorMid;
-      uniform vec4 uColorHigh;
+      uniform sampler2D uColormap;
       uniform float uMinValue;
       uniform float uMaxValue;
+      // Texture row of the oldest frame divided by historyLength
+      uniform highp float uScrollOffset;
+      // Maps [0, 1] onto the colormap texel centers
+      uniform vec2 uColormapScale;
       
       void main(void) {
-        float value = texture2D(uSampler, vTextureCoord).r;
-        
-        // Normalize the value
-        float normalizedValue = (value - uMinValue) / (uMaxValue - uMinValue);
-        normalizedValue = clamp(normalizedValue, 0.0, 1.0);
-        
-        // Calculate color using gradient between low, mid, and high colors
-        vec4 color;
-        if (normalizedValue < 0.5) {
-          // Blend from low to mid
-          color = mix(uColorLow, uColorMid, normalizedValue * 2.0);
-        } else {
-          // Blend from mid to high
-          color = mix(uColorMid, uColorHigh, (normalizedValue - 0.5) * 2.0);
-        }
-        
-        gl_FragColor = color;
+        // Frames are texture rows: the on-screen column picks the row in the
+        // circular buffer, the on-screen row picks the coefficient texel
+        highp vec2 coord = vec2(vTextureCoord.y, fract(vTextureCoord.x + uScrollOffset));
+        float value = texture2D(uSampler, coord).r;
+        float normalizedValue = clamp((value - uMinValue) / (uMaxValue - uMinValue), 0.0, 1.0);
+        gl_FragColor = texture2D(uColormap, vec2(normalizedValue * uColormapScale.x + uColormapScale.y, 0.5));
       }
     `;
 
@@ -131,11 +183,11 @@ export class WebGLSpectrogramRenderer {
       },
       uniformLocations: {
         uSampler: this.gl.getUniformLocation(this.shaderProgram, 'uSampler'),
-        uColorLow: this.gl.getUniformLocation(this.shaderProgram, 'uColorLow'),
-        uColorMid: this.gl.getUniformLocation(this.shaderProgram, 'uColorMid'),
-        uColorHigh: this.gl.getUniformLocation(this.shaderProgram, 'uColorHigh'),
+        uColormap: this.gl.getUniformLocation(this.shaderProgram, 'uColormap'),
+        uColormapScale: this.gl.getUniformLocation(this.shaderProgram, 'uColormapScale'),
         uMinValue: this.gl.getUniformLocation(this.shaderProgram, 'uMinValue'),
         uMaxValue: this.gl.getUniformLocation(this.shaderProgram, 'uMaxValue'),
+        uScrollOffset: this.gl.getUniformLocation(this.shaderProgram, 'uScrollOffset'),
       },
     };
   }
@@ -209,6 +261,28 @@ export class WebGLSpectrogramRenderer {
     this.gl.texParameteri(this.gl.TEXTURE_2D, this.gl.TEXTURE_MIN_FILTER, this.gl.NEAREST);
     this.gl.texParameteri(this.gl.TEXTURE_2D, this.gl.TEXTURE_MAG_FILTER, this.gl.NEAREST);
     
+    // Row uploads are coefficientCount texels wide, which need not be a
+    // multiple of 4 bytes in the UNSIGNED_BYTE path
+    this.gl.pixelStorei(this.gl.UNPACK_ALIGNMENT, 1);
+    
+    if (this.isWebGL2) {
+      // Single-channel float storage, always available for sampling with
+      // NEAREST filtering; R16F halves the upload for the driver to convert
+      this.gl.texStorage2D(
+        this.gl.TEXTURE_2D,
+        1,
+        this.options.halfFloat ? this.gl.R16F : this.gl.R32F,
+        this.options.coefficientCount,
+        this.options.historyLength
+      );
+      this.gl.texSubImage2D(
+        this.gl.TEXTURE_2D, 0, 0, 0, this.options.coefficientCount, this.options.historyLength,
+        this.gl.RED, this.gl.FLOAT, this.data
+      );
+      this.useUint8 = false;
+      return;
+    }
+    
     // Check for floating point texture support
     const ext = this.gl.getExtension('OES_texture_float');
     if (!ext) {
@@ -226,8 +300,8 @@ export class WebGLSpectrogramRenderer {
         this.gl.TEXTURE_2D,
         0,
         this.gl.LUMINANCE,
-        this.options.historyLength,
         this.options.coefficientCount,
+        this.options.historyLength,
         0,
         this.gl.LUMINANCE,
         this.gl.UNSIGNED_BYTE,
@@ -242,8 +316,8 @@ export class WebGLSpectrogramRenderer {
         this.gl.TEXTURE_2D,
         0,
         this.gl.LUMINANCE,
-        this.options.historyLength,
         this.options.coefficientCount,
+        this.options.historyLength,
         0,
         this.gl.LUMINANCE,
         this.gl.FLOAT,
@@ -254,89 +328,159 @@ export class WebGLSpectrogramRenderer {
   }
   
   /**
-   * Update the data with new coefficients
-   * @param {Array|Float32Array} newCoefficients - Array of cepstral coefficients
+   * Build the colormap texture: colorLow -> colorMid -> colorHigh sampled at
+   * COLORMAP_SIZE points and linearly filtered by the GPU, so the fragment
+   * shader does a single lookup and a color change only rewrites this texture
    */
-  updateData(newCoefficients) {
-    if (newCoefficients.length !== this.options.coefficientCount) {
-      console.warn(`Expected ${this.options.coefficientCount} coefficients, got ${newCoefficients.length}`);
-      return;
+  initColormap() {
+    if (!this.colormapTexture) {
+      this.colormapTexture = this.gl.createTexture();
+      this.gl.bindTexture(this.gl.TEXTURE_2D, this.colormapTexture);
+      this.gl.texParameteri(this.gl.TEXTURE_2D, this.gl.TEXTURE_WRAP_S, this.gl.CLAMP_TO_EDGE);
+      this.gl.texParameteri(this.gl.TEXTURE_2D, this.gl.TEXTURE_WRAP_T, this.gl.CLAMP_TO_EDGE);
+      this.gl.texParameteri(this.gl.TEXTURE_2D, this.gl.TEXTURE_MIN_FILTER, this.gl.LINEAR);
+      this.gl.texParameteri(this.gl.TEXTURE_2D, this.gl.TEXTURE_MAG_FILTER, this.gl.LINEAR);
     }
     
-    // Completely restructure data handling for column-based progression
-    
-    // Create a 2D structure for easier manipulation
-    const dataArray = [];
-    for (let y = 0; y < this.options.coefficientCount; y++) {
-      dataArray[y] = [];
-      for (let x = 0; x < this.options.historyLength; x++) {
-        dataArray[y][x] = this.data[y * this.options.historyLength + x];
+    const { colorLow, colorMid, colorHigh } = this.options;
+    const texels = new Uint8Array(COLORMAP_SIZE * 4);
+    for (let i = 0; i < COLORMAP_SIZE; i++) {
+      const t = i / (COLORMAP_SIZE - 1);
+      // Blend from low to mid, then from mid to high
+      const [from, to, f] = t < 0.5 ? [colorLow, colorMid, t * 2] : [colorMid, colorHigh, (t - 0.5) * 2];
+      for (let c = 0; c < 4; c++) {
+        texels[i * 4 + c] = Math.round(255 * Math.min(Math.max(from[c] + (to[c] - from[c]) * f, 0), 1));
       }
     }
     
-    // Shift all columns to the left
-    for (let y = 0; y < this.options.coefficientCount; y++) {
-      for (let x = 0; x < this.options.historyLength - 1; x++) {
-        dataArray[y][x] = dataArray[y][x + 1];
-      }
+    this.gl.bindTexture(this.gl.TEXTURE_2D, this.colormapTexture);
+    this.gl.texImage2D(
+      this.gl.TEXTURE_2D, 0, this.gl.RGBA, COLORMAP_SIZE, 1, 0,
+      this.gl.RGBA, this.gl.UNSIGNED_BYTE, texels
+    );
+  }
+  
+  /**
+   * Change display options in place, keeping the GPU history. Colors only
+   * rewrite the colormap; normalizeFunction and the value range apply to the
+   * next frames and the next render.
+   * @param {object} options - Any of colorLow, colorMid, colorHigh, minValue,
+   *   maxValue, normalizeFunction
+   */
+  updateOptions(options) {
+    const colorsChanged = ['colorLow', 'colorMid', 'colorHigh'].some((key) =>
+      key in options && String(options[key]) !== String(this.options[key]));
+    this.options = { ...this.options, ...options };
+    if (colorsChanged) {
+      this.initColormap();
+    }
+  }
+  
+  /**
+   * Update the data with new coefficients
+   * @param {Array|Float32Array} newCoefficients - Array of cepstral coefficients;
+   *   longer frames (statics followed by deltas) draw their first coefficientCount
+   */
+  updateData(newCoefficients) {
+    if (newCoefficients.length < this.options.coefficientCount) {
+      console.warn(`Expected ${this.options.coefficientCount} coefficients, got ${newCoefficients.length}`);
+      return;
     }
     
-    // Add new coefficient values to the rightmost column
-    for (let y = 0; y < this.options.coefficientCount; y++) {
-      // Use reversed index to position C0 at the bottom
-      const coeffIndex = this.options.coefficientCount - 1 - y;
+    const count = this.options.coefficientCount;
+    
+    // Build the new row, C0 in the last texel (bottom of the display)
+    for (let x = 0; x < count; x++) {
+      const coeffIndex = count - 1 - x;
       let value = newCoefficients[coeffIndex];
       
       // Apply custom normalization if provided
       if (this.options.normalizeFunction) {
         value = this.options.normalizeFunction(value, coeffIndex);
       }
-      
-      // Set the value in the rightmost column
-      dataArray[y][this.options.historyLength - 1] = value;
+      this.row[x] = value;
     }
     
-    // Flatten the 2D array back to 1D for WebGL
-    for (let y = 0; y < this.options.coefficientCount; y++) {
-      for (let x = 0; x < this.options.historyLength; x++) {
-        this.data[y * this.options.historyLength + x] = dataArray[y][x];
-      }
+    this.uploadRows(this.row, this.writeRow, 1);
+    this.writeRow = (this.writeRow + 1) % this.options.historyLength;
+  }
+  
+  /**
+   * Render straight from a WASM history buffer instead of updateData.
+   * @param {Float32Array} view - SignalProcessor.getHistoryView(): historyLength
+   *   rows of coefficientCount display values, already normalized
+   * @param {Uint8Array} [byteView] - SignalProcessor.getHistoryBytesView(); when
+   *   the texture is UNSIGNED_BYTE these rows are uploaded as-is
+   */
+  attachHistory(view, byteView = null) {
+    const count = this.options.coefficientCount;
+    if (view.length !== count * this.options.historyLength) {
+      console.warn(`History view has ${view.length} values, expected ${count * this.options.historyLength}`);
+      return;
     }
-    
-    // Update the texture with new data
+    this.historyQuantized = this.useUint8 && !!byteView && byteView.length === view.length;
+    if (this.historyQuantized) {
+      view = byteView;
+    }
+    this.history = view;
+    // One view per starting row, created once so uploads allocate nothing
+    this.historyRows = [];
+    for (let r = 0; r < this.options.historyLength; r++) {
+      this.historyRows.push(view.subarray(r * count));
+    }
+    this.historyUploaded = 0;
+  }
+  
+  /**
+   * Upload the rows the processor wrote since the last call (at most two
+   * texSubImage2D calls, one when the range does not wrap).
+   * @param {number} writeRow - SignalProcessor.getHistoryWriteRow()
+   * @param {number} framesWritten - SignalProcessor.getHistoryFramesWritten()
+   */
+  updateFromHistory(writeRow, framesWritten) {
+    if (!this.history) return;
+    const rows = this.options.historyLength;
+    let pending = Math.min(framesWritten - this.historyUploaded, rows);
+    if (pending <= 0) return;
+    
+    let start = (writeRow - pending + rows) % rows;
+    while (pending > 0) {
+      const n = Math.min(pending, rows - start);
+      this.uploadRows(this.historyRows[start], start, n);
+      pending -= n;
+      start = (start + n) % rows;
+    }
+    this.historyUploaded = framesWritten;
+    this.writeRow = writeRow;
+  }
+  
+  /**
+   * Overwrite numRows texture rows starting at firstRow with source values
+   * (display floats, or bytes already quantized by the processor)
+   */
+  uploadRows(source, firstRow, numRows) {
+    const count = this.options.coefficientCount;
     this.gl.bindTexture(this.gl.TEXTURE_2D, this.dataTexture);
     
-    if (this.useUint8) {
-      // Convert Float32Array to Uint8Array for compatibility
-      const uint8Data = new Uint8Array(this.data.length);
-      for (let i = 0; i < this.data.length; i++) {
+    if (this.useUint8 && source instanceof Uint8Array) {
+      this.gl.texSubImage2D(
+        this.gl.TEXTURE_2D, 0, 0, firstRow, count, numRows,
+        this.gl.LUMINANCE, this.gl.UNSIGNED_BYTE, source
+      );
+    } else if (this.useUint8) {
+      const n = count * numRows;
+      for (let i = 0; i < n; i++) {
         // Map normalized range to 0-255
-        uint8Data[i] = Math.min(255, Math.max(0, Math.floor(this.data[i] * 2.55)));
+        this.rowUint8[i] = Math.min(255, Math.max(0, Math.floor(source[i] * 2.55)));
       }
-      
-      this.gl.texImage2D(
-        this.gl.TEXTURE_2D,
-        0,
-        this.gl.LUMINANCE,
-        this.options.historyLength,
-        this.options.coefficientCount,
-        0,
-        this.gl.LUMINANCE,
-        this.gl.UNSIGNED_BYTE,
-        uint8Data
+      this.gl.texSubImage2D(
+        this.gl.TEXTURE_2D, 0, 0, firstRow, count, numRows,
+        this.gl.LUMINANCE, this.gl.UNSIGNED_BYTE, this.rowUint8
       );
     } else {
-      // Use floating point format if supported
-      this.gl.texImage2D(
-        this.gl.TEXTURE_2D,
-        0,
-        this.gl.LUMINANCE,
-        this.options.historyLength,
-        this.options.coefficientCount,
-        0,
-        this.gl.LUMINANCE,
-        this.gl.FLOAT,
-        this.data
+      this.gl.texSubImage2D(
+        this.gl.TEXTURE_2D, 0, 0, firstRow, count, numRows,
+        this.isWebGL2 ? this.gl.RED : this.gl.LUMINANCE, this.gl.FLOAT, source
       );
     }
   }
@@ -375,18 +519,27 @@ export class WebGLSpectrogramRenderer {
     );
     this.gl.enableVertexAttribArray(this.programInfo.attribLocations.textureCoord);
     
-    // Set uniforms for colors and value range
-    this.gl.uniform4fv(this.programInfo.uniformLocations.uColorLow, this.options.colorLow);
-    this.gl.uniform4fv(this.programInfo.uniformLocations.uColorMid, this.options.colorMid);
-    this.gl.uniform4fv(this.programInfo.uniformLocations.uColorHigh, this.options.colorHigh);
-    this.gl.uniform1f(this.programInfo.uniformLocations.uMinValue, this.options.minValue);
-    this.gl.uniform1f(this.programInfo.uniformLocations.uMaxValue, this.options.maxValue);
+    // Set uniforms for the value range; UNSIGNED_BYTE texels hold the 0-100
+    // display range as 0-1
+    const valueScale = this.useUint8 ? 0.01 : 1;
+    this.gl.uniform1f(this.programInfo.uniformLocations.uMinValue, this.options.minValue * valueScale);
+    this.gl.uniform1f(this.programInfo.uniformLocations.uMaxValue, this.options.maxValue * valueScale);
+    this.gl.uniform2f(this.programInfo.uniformLocations.uColormapScale,
+      (COLORMAP_SIZE - 1) / COLORMAP_SIZE, 0.5 / COLORMAP_SIZE);
+    // The row after the newest one holds the oldest frame
+    this.gl.uniform1f(this.programInfo.uniformLocations.uScrollOffset,
+      this.writeRow / this.options.historyLength);
     
     // Bind the texture
     this.gl.activeTexture(this.gl.TEXTURE0);
     this.gl.bindTexture(this.gl.TEXTURE_2D, this.dataTexture);
     this.gl.uniform1i(this.programInfo.uniformLocations.uSampler, 0);
     
+    this.gl.activeTexture(this.gl.TEXTURE1);
+    this.gl.bindTexture(this.gl.TEXTURE_2D, this.colormapTexture);
+    this.gl.uniform1i(this.programInfo.uniformLocations.uColormap, 1);
+    this.gl.activeTexture(this.gl.TEXTURE0);
+    
     // Draw the quad
     this.gl.drawArrays(this.gl.TRIANGLE_STRIP, 0, 4);
   }
@@ -428,6 +581,8 @@ export class WebGLSpectrogramRenderer {
    * Update the renderer when canvas size changes
    */
   resize(width, height) {
+    // Only the drawing buffer changes; the textures are independent of it
+    if (this.canvas.width === width && this.canvas.height === height) return;
     this.canvas.width = width;
     this.canvas.height = height;
     this.gl.viewport(0, 0, width, height);
@@ -445,5 +600,6 @@ export class WebGLSpectrogramRenderer {
     this.gl.deleteBuffer(this.buffers.position);
     this.gl.deleteBuffer(this.buffers.textureCoord);
     this.gl.deleteTexture(this.dataTexture);
+    this.gl.deleteTexture(this.colormapTexture);
   }
 }
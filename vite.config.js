@@ -1,8 +1,24 @@
 import { defineConfig } from 'vite'
 import react from '@vitejs/plugin-react'
 
+// Cross-origin isolation is required for the SharedArrayBuffer frame ring
+// between the MFCC AudioWorklet and the UI thread
+const isolationHeaders = {
+  'Cross-Origin-Opener-Policy': 'same-origin',
+  'Cross-Origin-Embedder-Policy': 'require-corp',
+}
+
 export default defineConfig({
   plugins: [react()],
+  server: {
+    headers: isolationHeaders,
+  },
+  preview: {
+    headers: isolationHeaders,
+  },
+  worker: {
+    format: 'es',
+  },
   build: {
     rollupOptions: {
       output: {